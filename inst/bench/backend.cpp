@@ -0,0 +1,82 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Compares latency of the `r_api` and the `native` backend for a cheap and
+// an adaptively subdivided integrand on finite and infinite ranges.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include $(R CMD config --cppflags)"
+//     LDFLAGS="$(R CMD config --ldflags)"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/backend.cpp $LDFLAGS
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 100000;
+    double sink = 0.;
+
+    const auto cheap = [](const double x) { return x * x; };
+    const auto peaked = [](const double x) {
+        return 1. / (1e-4 + (x - 0.3) * (x - 0.3));
+    };
+    const auto tail = [](const double x) { return std::exp(-x * x); };
+    const auto inf = std::numeric_limits<double>::infinity();
+
+    bench::print_header();
+    for (const auto backend :
+         {integrator::backend_type::r_api, integrator::backend_type::native}) {
+        auto config = integrator::config_type{};
+        config.backend = backend;
+        const auto integrate = integrator{config};
+        auto workspace = integrator::workspace_type{config};
+        const auto label =
+            backend == integrator::backend_type::r_api ? "r_api" : "native";
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s: x^2 on [0, 1]", label);
+        bench::print(
+            name,
+            bench::measure(
+                [&] { return integrate(cheap, 0., 1., workspace).value; }, n,
+                sink));
+        std::snprintf(name, sizeof(name), "%s: peak on [0, 1]", label);
+        bench::print(
+            name,
+            bench::measure(
+                [&] { return integrate(peaked, 0., 1., workspace).value; }, n,
+                sink));
+        std::snprintf(name, sizeof(name), "%s: exp(-x^2) on [0, inf)", label);
+        bench::print(
+            name,
+            bench::measure(
+                [&] { return integrate(tail, 0., inf, workspace).value; }, n,
+                sink));
+    }
+
+    return sink > 0. ? 0 : 1;
+}
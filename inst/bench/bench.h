@@ -0,0 +1,95 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Minimal helpers for the standalone micro-benchmarks in `inst/bench`.
+//
+// NOTE: each benchmark is a single translation unit; this header replaces the
+// global allocation functions to count heap allocations and must therefore be
+// included exactly once per program.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace bench {
+
+inline std::atomic<std::size_t> &allocation_counter() {
+    static std::atomic<std::size_t> counter{0};
+    return counter;
+}
+
+struct measurement {
+    double ns_per_call;
+    double allocations_per_call;
+};
+
+// NOTE: `fn` is called `n` times after `n / 10` warm-up calls; the returned
+// values are accumulated into `sink` to keep the calls observable.
+template <typename Fn>
+measurement measure(Fn &&fn, const std::size_t n, double &sink) {
+    for (std::size_t i = 0; i < n / 10; ++i) {
+        sink += fn();
+    }
+    const auto allocations = allocation_counter().load();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n; ++i) {
+        sink += fn();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const auto elapsed =
+        std::chrono::duration<double, std::nano>(stop - start).count();
+    return measurement{
+        elapsed / static_cast<double>(n),
+        static_cast<double>(allocation_counter().load() - allocations) /
+            static_cast<double>(n)};
+}
+
+inline void print_header() {
+    std::printf("%-40s %14s %14s\n", "benchmark", "ns/call", "allocs/call");
+}
+
+inline void print(const char *name, const measurement &m) {
+    std::printf("%-40s %14.1f %14.2f\n", name, m.ns_per_call,
+                m.allocations_per_call);
+}
+
+}  // namespace bench
+
+// NOTE: the replacements are not inlined; otherwise GCC sees `std::free`
+// releasing memory from `operator new` and warns with
+// `-Wmismatched-new-delete`.
+__attribute__((noinline)) void *operator new(std::size_t size) {
+    bench::allocation_counter().fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+__attribute__((noinline)) void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void *ptr,
+                                               std::size_t) noexcept {
+    std::free(ptr);
+}
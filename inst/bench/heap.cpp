@@ -0,0 +1,79 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Compares the scaling in `max_subdivisions` of the `native` backend, which
+// keeps the subintervals in a list ordered by linear insertion, and the
+// `native_heap` backend, which keeps them in a binary heap. The integrand
+// `sin(1 / x)` on `(0, 1]` requires all subdivisions, possibly ending with a
+// roundoff error.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include -DINTEGRATECPP_NO_R_API"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/heap.cpp
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    double sink = 0.;
+
+    const auto fn = [](const double x) { return std::sin(1. / x); };
+
+    bench::print_header();
+    for (const auto limit : {100, 1000, 10000, 100000}) {
+        // NOTE: keep the number of function evaluations per benchmark fixed.
+        const auto n = static_cast<std::size_t>(1000000 / limit);
+        for (const auto backend : {integrator::backend_type::native,
+                                   integrator::backend_type::native_heap}) {
+            auto config = integrator::config_type{limit, 1e-12, 1e-12,
+                                                  4 * limit, backend};
+            const auto integrate = integrator{config};
+            auto workspace = integrator::workspace_type{config};
+
+            char name[64];
+            std::snprintf(
+                name, sizeof(name), "%s: limit = %d",
+                backend == integrator::backend_type::native ? "native"
+                                                            : "native_heap",
+                limit);
+            bench::print(name, bench::measure(
+                                   [&] {
+                                       try {
+                                           return integrate(fn, 0., 1.,
+                                                            workspace)
+                                               .value;
+                                       } catch (
+                                           const integratecpp::
+                                               integration_runtime_error &e) {
+                                           return e.result().value;
+                                       }
+                                   },
+                                   n, sink));
+        }
+    }
+
+    return sink != 0. ? 0 : 1;
+}
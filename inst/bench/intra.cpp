@@ -0,0 +1,77 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Compares latency of `integratecpp::integrator::operator()()` and
+// `integratecpp::integrator::integrate_parallel()` for increasing numbers of
+// threads and an integrand which is expensive to evaluate, emulated by a
+// fixed number of iterations of a logistic map.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include -DINTEGRATECPP_NO_R_API"
+//     g++ -O2 -std=c++11 -pthread $CPPFLAGS inst/bench/intra.cpp
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <thread>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 10;
+    double sink = 0.;
+
+    const auto fn = [](const double x) {
+        auto y = 0.5;
+        for (auto i = 0; i < 10000; ++i) {
+            y = 3.7 * y * (1. - y);
+        }
+        return (1. + 1e-12 * y) / (1e-4 + (x - 0.3) * (x - 0.3));
+    };
+
+    const auto integrate = integrator{integrator::config_type{1000, 1e-10}};
+
+    bench::print_header();
+    bench::print("operator()",
+                 bench::measure([&] { return integrate(fn, 0., 1.).value; },
+                                n, sink));
+
+    const auto hardware_concurrency =
+        static_cast<int>(std::thread::hardware_concurrency());
+    for (auto thread_count = 1; thread_count <= hardware_concurrency;
+         thread_count *= 2) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "integrate_parallel(%d)",
+                      thread_count);
+        bench::print(name, bench::measure(
+                               [&] {
+                                   return integrate
+                                       .integrate_parallel(fn, 0., 1.,
+                                                           thread_count)
+                                       .value;
+                               },
+                               n, sink));
+    }
+
+    return sink != 0. ? 0 : 1;
+}
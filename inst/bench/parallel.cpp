@@ -0,0 +1,103 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Compares latency per item of `integratecpp::integrator::integrate_batch()`
+// and `integratecpp::integrator::integrate_batch_parallel()` for increasing
+// numbers of threads. The costs of the items vary as some of them require
+// many subdivisions.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include -DINTEGRATECPP_NO_R_API"
+//     g++ -O2 -std=c++11 -pthread $CPPFLAGS inst/bench/parallel.cpp
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 10;
+    constexpr std::size_t size = 100000;
+    double sink = 0.;
+
+    const auto fn = [](const double x) { return std::sin(1. / x); };
+
+    // NOTE: intervals close to zero require many subdivisions.
+    auto lower = std::vector<double>(size);
+    auto upper = std::vector<double>(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        lower[i] = i % 5 == 0 ? 0. : 1. + static_cast<double>(i % 7);
+        upper[i] = lower[i] + 1.;
+    }
+
+    const auto integrate = integrator{integrator::config_type{100, 1e-6}};
+    auto out = std::vector<integrator::return_type>(size);
+    auto status = std::vector<integrator::status_type>(size);
+    auto errors = std::vector<std::exception_ptr>(size);
+
+    const auto sum = [&out] {
+        auto value = 0.;
+        for (const auto &item : out) {
+            value += item.value;
+        }
+        return value;
+    };
+
+    // NOTE: report per item instead of per batch.
+    bench::print_header();
+    const auto serial = bench::measure(
+        [&] {
+            integrate.integrate_batch(fn, lower, upper, out, status);
+            return sum();
+        },
+        n, sink);
+    bench::print("integrate_batch()",
+                 bench::measurement{serial.ns_per_call / size,
+                                    serial.allocations_per_call / size});
+
+    const auto hardware_concurrency =
+        static_cast<int>(std::thread::hardware_concurrency());
+    for (auto thread_count = 1; thread_count <= hardware_concurrency;
+         thread_count *= 2) {
+        const auto parallel = bench::measure(
+            [&] {
+                integrate.integrate_batch_parallel(fn, lower, upper, out,
+                                                   errors, thread_count);
+                return sum();
+            },
+            n, sink);
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "integrate_batch_parallel(%d)",
+                      thread_count);
+        bench::print(name,
+                     bench::measurement{parallel.ns_per_call / size,
+                                        parallel.allocations_per_call / size});
+    }
+
+    return sink != 0. ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Compares latency and function evaluations of `Rdqags` (`native` backend)
+// and `dqagp` with the kinks and discontinuities of piecewise integrands as
+// break points: a call payoff `max(x - k, 0)` times a normal density, a
+// piecewise linear density, and a step function. Both reuse a workspace.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include -DINTEGRATECPP_NO_R_API"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/points.cpp
+//     ./a.out
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 10000;
+    double sink = 0.;
+
+    struct problem {
+        const char *name;
+        std::function<double(double)> fn;
+        double lower;
+        double upper;
+        std::vector<double> points;
+    };
+    const auto problems = std::vector<problem>{
+        {"call payoff",
+         [](const double x) {
+             return std::max(x - 0.3, 0.) * std::exp(-x * x / 2.);
+         },
+         -5., 5., {0.3}},
+        {"piecewise linear",
+         [](const double x) {
+             return x < -1. ? 0. : x < 0. ? x + 1. : x < 1. ? 1. - x : 0.;
+         },
+         -3., 2., {-1., 0., 1.}},
+        {"step",
+         [](const double x) {
+             return x < 0.25 ? 1. : x < 0.5 ? 2. : x < 0.75 ? 3. : 4.;
+         },
+         0., 1., {0.25, 0.5, 0.75}}};
+
+    const auto integrate = integrator{integrator::config_type{
+        100, 1e-8, 1e-8, 400, integrator::backend_type::native}};
+    auto workspace = integrator::workspace_type{};
+
+    std::printf("%-40s %14s %14s\n", "benchmark", "ns/call", "neval");
+    for (const auto &p : problems) {
+        char name[64];
+        const auto qags = integrate(p.fn, p.lower, p.upper, workspace);
+        std::snprintf(name, sizeof(name), "%s: qags", p.name);
+        std::printf("%-40s %14.1f %14d\n", name,
+                    bench::measure(
+                        [&] {
+                            return integrate(p.fn, p.lower, p.upper, workspace)
+                                .value;
+                        },
+                        n, sink)
+                        .ns_per_call,
+                    qags.neval);
+
+        const auto qagp =
+            integrate(p.fn, p.lower, p.upper, p.points, workspace);
+        std::snprintf(name, sizeof(name), "%s: qagp", p.name);
+        std::printf("%-40s %14.1f %14d\n", name,
+                    bench::measure(
+                        [&] {
+                            return integrate(p.fn, p.lower, p.upper, p.points,
+                                             workspace)
+                                .value;
+                        },
+                        n, sink)
+                        .ns_per_call,
+                    qagp.neval);
+    }
+
+    return sink != 0. ? 0 : 1;
+}
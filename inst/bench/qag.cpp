@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Compares latency, subdivisions, and function evaluations of `Rdqags`
+// (`native` backend) and `dqag` (`native_qag` backend) with the 15- to
+// 61-point Gauss-Kronrod rules on smooth integrands, for which `dqag` needs
+// no extrapolation. Both reuse a workspace.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include -DINTEGRATECPP_NO_R_API"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/qag.cpp
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 10000;
+    double sink = 0.;
+
+    struct problem {
+        const char *name;
+        std::function<double(double)> fn;
+        double lower;
+        double upper;
+    };
+    const auto problems = std::vector<problem>{
+        {"oscillatory",
+         [](const double x) { return std::cos(50. * x) * std::exp(x); },
+         0.,
+         3.},
+        {"gaussian peak",
+         [](const double x) { return std::exp(-100. * (x - .5) * (x - .5)); },
+         0.,
+         1.},
+        {"runge",
+         [](const double x) { return 1. / (1. + 25. * x * x); },
+         -1.,
+         1.}};
+
+    std::printf("%-40s %14s %14s %14s\n", "benchmark", "ns/call",
+                "subdivisions", "neval");
+    for (const auto &p : problems) {
+        for (const auto rule_points : {0, 15, 21, 31, 41, 51, 61}) {
+            // NOTE: `rule_points == 0` denotes the `native` backend.
+            const auto integrate = integrator{integrator::config_type{
+                100, 1e-10, 1e-10, 400,
+                rule_points == 0 ? integrator::backend_type::native
+                                 : integrator::backend_type::native_qag,
+                rule_points == 0 ? 21 : rule_points}};
+            auto workspace = integrator::workspace_type{};
+            const auto result = integrate(p.fn, p.lower, p.upper, workspace);
+
+            char name[64];
+            if (rule_points == 0) {
+                std::snprintf(name, sizeof(name), "%s: native", p.name);
+            } else {
+                std::snprintf(name, sizeof(name), "%s: native_qag, %d points",
+                              p.name, rule_points);
+            }
+            std::printf("%-40s %14.1f %14d %14d\n", name,
+                        bench::measure(
+                            [&] {
+                                return integrate(p.fn, p.lower, p.upper,
+                                                 workspace)
+                                    .value;
+                            },
+                            n, sink)
+                            .ns_per_call,
+                        result.subdivisions, result.neval);
+        }
+    }
+
+    return sink != 0. ? 0 : 1;
+}
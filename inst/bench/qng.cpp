@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Compares latency and function evaluations of `Rdqags` (`native` backend)
+// and the non-adaptive `dqng` rules tried first (`native_qng` backend) on
+// smooth integrands, which are integrated by one of the
+// Gauss-Kronrod-Patterson rules, and on an integrand with an algebraic
+// singularity, for which `native_qng` falls back to `Rdqags`. Both reuse a
+// workspace.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include -DINTEGRATECPP_NO_R_API"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/qng.cpp
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 10000;
+    double sink = 0.;
+
+    struct problem {
+        const char *name;
+        std::function<double(double)> fn;
+        double lower;
+        double upper;
+    };
+    const auto problems = std::vector<problem>{
+        {"exp", [](const double x) { return std::exp(x); }, 0., 1.},
+        {"oscillatory",
+         [](const double x) { return std::cos(30. * x); },
+         0.,
+         1.},
+        {"runge",
+         [](const double x) { return 1. / (1. + 25. * x * x); },
+         -1.,
+         1.},
+        {"normal density",
+         [](const double x) { return std::exp(-x * x / 2.); },
+         -5.,
+         5.},
+        {"singular",
+         [](const double x) { return 1. / std::pow(x, 0.7); },
+         0.,
+         1.}};
+
+    std::printf("%-40s %14s %14s\n", "benchmark", "ns/call", "neval");
+    for (const auto &p : problems) {
+        for (const auto backend : {integrator::backend_type::native,
+                                   integrator::backend_type::native_qng}) {
+            const auto integrate = integrator{
+                integrator::config_type{100, 1e-8, 1e-8, 400, backend}};
+            auto workspace = integrator::workspace_type{};
+
+            char name[64];
+            std::snprintf(
+                name, sizeof(name), "%s: %s", p.name,
+                backend == integrator::backend_type::native ? "native"
+                                                            : "native_qng");
+            std::printf(
+                "%-40s %14.1f %14d\n", name,
+                bench::measure(
+                    [&] {
+                        return integrate(p.fn, p.lower, p.upper, workspace)
+                            .value;
+                    },
+                    n, sink)
+                    .ns_per_call,
+                integrate(p.fn, p.lower, p.upper, workspace).neval);
+        }
+    }
+
+    return sink != 0. ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Compares latency and heap allocations per item of a loop over
+// `integratecpp::integrator::operator()()`, catching integration errors, and
+// `integratecpp::integrator::try_integrate()`, checking the status, for
+// intervals of which every fifth requires more than the maximum number of
+// subdivisions. Both loops reuse a workspace.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include $(R CMD config --cppflags)"
+//     LDFLAGS="$(R CMD config --ldflags)"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/status.cpp $LDFLAGS
+//
+// or without R for the `native` backend:
+//
+//     CPPFLAGS="-Iinst/include -DINTEGRATECPP_NO_R_API"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/status.cpp
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 100;
+    constexpr std::size_t size = 10000;
+    double sink = 0.;
+
+    const auto fn = [](const double x) { return std::sin(1. / x); };
+
+    // NOTE: intervals close to zero exhaust the subdivisions.
+    auto lower = std::vector<double>(size);
+    auto upper = std::vector<double>(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        lower[i] = i % 5 == 0 ? 0. : 1. + static_cast<double>(i % 7);
+        upper[i] = lower[i] + 1.;
+    }
+
+    const auto integrate = integrator{10, 1e-6};
+    auto workspace = integrator::workspace_type{integrate.config()};
+
+    const auto throwing = bench::measure(
+        [&] {
+            auto value = 0.;
+            for (std::size_t i = 0; i < size; ++i) {
+                try {
+                    value += integrate(fn, lower[i], upper[i], workspace).value;
+                } catch (const integratecpp::integration_runtime_error &e) {
+                    value += e.result().value;
+                }
+            }
+            return value;
+        },
+        n, sink);
+    const auto status = bench::measure(
+        [&] {
+            auto value = 0.;
+            auto out = integrator::return_type{};
+            for (std::size_t i = 0; i < size; ++i) {
+                integrate.try_integrate(fn, lower[i], upper[i], out, workspace);
+                value += out.value;
+            }
+            return value;
+        },
+        n, sink);
+
+    // NOTE: report per item instead of per loop.
+    bench::print_header();
+    bench::print("operator() with catch",
+                 bench::measurement{throwing.ns_per_call / size,
+                                    throwing.allocations_per_call / size});
+    bench::print("try_integrate()",
+                 bench::measurement{status.ns_per_call / size,
+                                    status.allocations_per_call / size});
+
+    return sink != 0. ? 0 : 1;
+}
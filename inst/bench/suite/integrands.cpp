@@ -0,0 +1,200 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// The one-dimensional Genz test families on `[0, 1]` and the singular
+// integrand `1 / x^0.7` for the benchmark suite in `inst/bench/suite/run.R`,
+// which compiles this file with `Rcpp::sourceCpp()`. All methods use the
+// same accuracies and maximum number of subdivisions and return the value, the
+// error estimate, and the number of function evaluations.
+
+// [[Rcpp::plugins(cpp11)]]
+// [[Rcpp::depends(integratecpp)]]
+// [[Rcpp::depends(RcppGSL)]]
+// [[Rcpp::depends(RcppEigen)]]
+// [[Rcpp::depends(RcppNumerical)]]
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include <RcppGSL.h>
+#include <RcppNumerical.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_integration.h>
+#include <integratecpp.h>
+
+namespace {
+
+const auto max_subdivisions = 100;
+const auto accuracy = std::pow(std::numeric_limits<double>::epsilon(), 0.25);
+
+// NOTE: families 1 to 6 are the oscillatory, product peak, corner peak,
+// Gaussian, continuous, and discontinuous families with difficulty `a` and
+// shift `u`; family 7 is the singular integrand.
+double genz(const int family, const double a, const double u,
+            const double x) {
+    switch (family) {
+        case 1:
+            return std::cos(2. * M_PI * u + a * x);
+        case 2:
+            return 1. / (1. / (a * a) + (x - u) * (x - u));
+        case 3:
+            return 1. / ((1. + a * x) * (1. + a * x));
+        case 4:
+            return std::exp(-a * a * (x - u) * (x - u));
+        case 5:
+            return std::exp(-a * std::abs(x - u));
+        case 6:
+            return x > u ? 0. : std::exp(a * x);
+        default:
+            return 1. / std::pow(x, 0.7);
+    }
+}
+
+Rcpp::List as_list(const double value, const double absolute_error,
+                   const double neval) {
+    return Rcpp::List::create(Rcpp::Named("value") = value,
+                              Rcpp::Named("abs.error") = absolute_error,
+                              Rcpp::Named("neval") = neval);
+}
+
+// NOTE: the parameters are `c(family, a, u, neval)`; the number of function
+// evaluations is accumulated in the last element.
+void genz_vectorized(double *x, int n, void *ex) {
+    auto *params = static_cast<double *>(ex);
+    for (auto i = 0; i < n; ++i) {
+        x[i] = genz(static_cast<int>(params[0]), params[1], params[2], x[i]);
+    }
+    params[3] += n;
+}
+
+struct gsl_params {
+    int family;
+    double a;
+    double u;
+    std::size_t neval;
+};
+
+double genz_gsl(double x, void *params) {
+    auto *p = static_cast<gsl_params *>(params);
+    ++p->neval;
+    return genz(p->family, p->a, p->u, x);
+}
+
+class genz_numer : public Numer::Func {
+   public:
+    genz_numer(const int family, const double a, const double u)
+        : family_{family}, a_{a}, u_{u} {}
+
+    double operator()(const double &x) const override {
+        ++neval_;
+        return genz(family_, a_, u_, x);
+    }
+
+    std::size_t neval() const noexcept { return neval_; }
+
+   private:
+    int family_;
+    double a_;
+    double u_;
+    mutable std::size_t neval_{0};
+};
+
+integratecpp::integrator::config_type config(const std::string &backend) {
+    auto cfg = integratecpp::integrator::config_type{};
+    cfg.max_subdivisions = max_subdivisions;
+    cfg.relative_accuracy = accuracy;
+    cfg.absolute_accuracy = accuracy;
+    cfg.work_size = 4 * max_subdivisions;
+    cfg.backend = backend == "native"
+                      ? integratecpp::integrator::backend_type::native
+                      : integratecpp::integrator::backend_type::r_api;
+    return cfg;
+}
+
+// NOTE: integration errors are reported by the results at the time of the
+// error, as for the other methods.
+template <typename Integrand_>
+Rcpp::List integrate_integratecpp(Integrand_ &&fn,
+                                  const std::string &backend) {
+    auto result = integratecpp::integrator::return_type{};
+    integratecpp::integrator{config(backend)}.try_integrate(
+        std::forward<Integrand_>(fn), 0., 1., result);
+    return as_list(result.value, result.absolute_error, result.neval);
+}
+
+}  // namespace
+
+// [[Rcpp::export(rng=false)]]
+SEXP genz_pointer() {
+    return R_MakeExternalPtrFn(reinterpret_cast<DL_FUNC>(&genz_vectorized),
+                               R_NilValue, R_NilValue);
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List integratecpp_scalar(const int family, const double a,
+                               const double u, const std::string backend) {
+    return integrate_integratecpp(
+        [family, a, u](const double x) { return genz(family, a, u, x); },
+        backend);
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List integratecpp_vectorized(const int family, const double a,
+                                   const double u,
+                                   const std::string backend) {
+    return integrate_integratecpp(
+        [family, a, u](const double *x, double *y, const int n) {
+            for (auto i = 0; i < n; ++i) {
+                y[i] = genz(family, a, u, x[i]);
+            }
+        },
+        backend);
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List gsl_qags(const int family, const double a, const double u) {
+    auto params = gsl_params{family, a, u, 0};
+    gsl_function fn;
+    fn.function = &genz_gsl;
+    fn.params = &params;
+
+    const auto handler = gsl_set_error_handler_off();
+    auto *workspace = gsl_integration_workspace_alloc(max_subdivisions);
+    auto value = 0.;
+    auto absolute_error = 0.;
+    gsl_integration_qags(&fn, 0., 1., accuracy, accuracy, max_subdivisions,
+                         workspace, &value, &absolute_error);
+    gsl_integration_workspace_free(workspace);
+    gsl_set_error_handler(handler);
+
+    return as_list(value, absolute_error, static_cast<double>(params.neval));
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List numer_gauss_kronrod21(const int family, const double a,
+                                 const double u) {
+    auto fn = genz_numer{family, a, u};
+    auto absolute_error = 0.;
+    auto code = 0;
+    const auto value = Numer::integrate(
+        fn, 0., 1., absolute_error, code, max_subdivisions, accuracy,
+        accuracy, Numer::Integrator<double>::GaussKronrod21);
+    return as_list(value, absolute_error, static_cast<double>(fn.neval()));
+}
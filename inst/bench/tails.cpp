@@ -0,0 +1,121 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+// Compares latency, function evaluations, and achieved error of `Rdqagi`
+// (`native` backend) and the exp-sinh and sinh-sinh rules
+// (`native_double_exponential` backend) on densities with heavy tails over
+// half-infinite and infinite ranges, and on the normal density for reference.
+// The nodes of the rules are computed before the first measurement and shared
+// by all integrations. Both reuse a workspace.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include -DINTEGRATECPP_NO_R_API"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/tails.cpp
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 10000;
+    double sink = 0.;
+
+    const auto pi = 4. * std::atan(1.);
+    const auto inf = std::numeric_limits<double>::infinity();
+    const auto student_t = [pi](const double x, const double df) {
+        return std::tgamma((df + 1.) / 2.) /
+               (std::sqrt(df * pi) * std::tgamma(df / 2.)) *
+               std::pow(1. + x * x / df, -(df + 1.) / 2.);
+    };
+
+    struct problem {
+        const char *name;
+        std::function<double(double)> fn;
+        double lower;
+        double upper;
+    };
+    const auto problems = std::vector<problem>{
+        {"cauchy", [&](const double x) { return student_t(x, 1.); }, -inf,
+         inf},
+        {"student t, df = 1.5",
+         [&](const double x) { return student_t(x, 1.5); }, -inf, inf},
+        {"student t, df = 3", [&](const double x) { return student_t(x, 3.); },
+         -inf, inf},
+        {"cauchy, left tail",
+         [&](const double x) { return 2. * student_t(x, 1.); }, -inf, 0.},
+        {"pareto, shape = 0.5",
+         [](const double x) { return .5 * std::pow(x, -1.5); }, 1., inf},
+        {"lognormal",
+         [pi](const double x) {
+             return std::exp(-.5 * std::log(x) * std::log(x)) /
+                    (x * std::sqrt(2. * pi));
+         },
+         0., inf},
+        {"normal",
+         [pi](const double x) {
+             return std::exp(-.5 * x * x) / std::sqrt(2. * pi);
+         },
+         -inf, inf}};
+
+    std::printf("%-48s %14s %14s %14s\n", "benchmark", "ns/call", "neval",
+                "error");
+    for (const auto &p : problems) {
+        for (const auto accuracy : {1.220703125e-4, 1e-10}) {
+            for (const auto backend :
+                 {integrator::backend_type::native,
+                  integrator::backend_type::native_double_exponential}) {
+                const auto integrate = integrator{integrator::config_type{
+                    100, accuracy, accuracy, 400, backend}};
+                auto workspace = integrator::workspace_type{};
+                const auto result =
+                    integrate(p.fn, p.lower, p.upper, workspace);
+
+                char name[64];
+                std::snprintf(
+                    name, sizeof(name), "%s: %s, %.0e", p.name,
+                    backend == integrator::backend_type::native
+                        ? "native"
+                        : "double exponential",
+                    accuracy);
+                std::printf(
+                    "%-48s %14.1f %14d %14.1e\n", name,
+                    bench::measure(
+                        [&] {
+                            return integrate(p.fn, p.lower, p.upper, workspace)
+                                .value;
+                        },
+                        n, sink)
+                        .ns_per_call,
+                    result.neval, std::abs(result.value - 1.));
+            }
+        }
+    }
+
+    return sink != 0. ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+// Compares latency, function evaluations, and achieved error of `Rdqags`
+// (`native` backend) and the tanh-sinh rule (`native_double_exponential`
+// backend) on integrands with singularities at the lower bound zero, where
+// the abscissae of the tanh-sinh rule are not limited by the spacing of
+// doubles near the bound. The nodes of the tanh-sinh rule are computed before
+// the first measurement and shared by all integrations. Both reuse a
+// workspace.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include -DINTEGRATECPP_NO_R_API"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/tanh_sinh.cpp
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 10000;
+    double sink = 0.;
+
+    struct problem {
+        const char *name;
+        std::function<double(double)> fn;
+        double lower;
+        double upper;
+        double value;
+    };
+    const auto pi = 4. * std::atan(1.);
+    const auto problems = std::vector<problem>{
+        {"1 / x^0.7",
+         [](const double x) { return 1. / std::pow(x, 0.7); },
+         0.,
+         1.,
+         1. / .3},
+        {"1 / x^0.9",
+         [](const double x) { return 1. / std::pow(x, 0.9); },
+         0.,
+         1.,
+         10.},
+        {"log(x)", [](const double x) { return std::log(x); }, 0., 1., -1.},
+        {"sqrt(x) * log(x)",
+         [](const double x) { return std::sqrt(x) * std::log(x); },
+         0.,
+         1.,
+         -4. / 9.},
+        {"exp(-x) / sqrt(x)",
+         [](const double x) { return std::exp(-x) / std::sqrt(x); },
+         0.,
+         1.,
+         std::sqrt(pi) * std::erf(1.)}};
+
+    std::printf("%-44s %14s %14s %14s\n", "benchmark", "ns/call", "neval",
+                "error");
+    for (const auto &p : problems) {
+        for (const auto accuracy : {1.220703125e-4, 1e-10}) {
+            for (const auto backend :
+                 {integrator::backend_type::native,
+                  integrator::backend_type::native_double_exponential}) {
+                const auto integrate = integrator{integrator::config_type{
+                    100, accuracy, accuracy, 400, backend}};
+                auto workspace = integrator::workspace_type{};
+                const auto result =
+                    integrate(p.fn, p.lower, p.upper, workspace);
+
+                char name[64];
+                std::snprintf(
+                    name, sizeof(name), "%s: %s, %.0e", p.name,
+                    backend == integrator::backend_type::native ? "native"
+                                                                : "tanh-sinh",
+                    accuracy);
+                std::printf(
+                    "%-44s %14.1f %14d %14.1e\n", name,
+                    bench::measure(
+                        [&] {
+                            return integrate(p.fn, p.lower, p.upper, workspace)
+                                .value;
+                        },
+                        n, sink)
+                        .ns_per_call,
+                    result.neval, std::abs(result.value - p.value));
+            }
+        }
+    }
+
+    return sink != 0. ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Compares latency and heap allocations of repeated integrations with and
+// without a reusable `integratecpp::integrator::workspace_type` and with a
+// `integratecpp::static_integrator`.
+//
+// Build and run from the package root, e.g.:
+//
+//     CPPFLAGS="-Iinst/include $(R CMD config --cppflags)"
+//     LDFLAGS="$(R CMD config --ldflags)"
+//     g++ -O2 -std=c++11 $CPPFLAGS inst/bench/workspace.cpp $LDFLAGS
+//     ./a.out
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+
+#include <integratecpp.h>
+
+#include "bench.h"
+
+int main() {
+    using integratecpp::integrator;
+
+    constexpr std::size_t n = 1000000;
+    double sink = 0.;
+
+    // NOTE: a cheap integrand that converges on the first rule application,
+    // i.e., the cost of a call is dominated by the overhead.
+    const auto fn = [](const double x) { return x * x; };
+
+    bench::print_header();
+    for (const int max_subdivisions : {100, 1000, 10000}) {
+        const auto config = integrator::config_type{
+            max_subdivisions, std::pow(std::numeric_limits<double>::epsilon(),
+                                       0.25)};
+        const auto integrate = integrator{config};
+        auto workspace = integrator::workspace_type{config};
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "per-call arrays (limit = %d)",
+                      max_subdivisions);
+        bench::print(name,
+                     bench::measure(
+                         [&] { return integrate(fn, 0., 1.).value; }, n,
+                         sink));
+        std::snprintf(name, sizeof(name), "workspace (limit = %d)",
+                      max_subdivisions);
+        bench::print(
+            name,
+            bench::measure(
+                [&] { return integrate(fn, 0., 1., workspace).value; }, n,
+                sink));
+    }
+
+    bench::print("static_integrator<100>",
+                 bench::measure(
+                     [&] {
+                         return integratecpp::static_integrator<100>{}(fn, 0.,
+                                                                       1.)
+                             .value;
+                     },
+                     n, sink));
+
+    return sink > 0. ? 0 : 1;
+}
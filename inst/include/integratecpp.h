@@ -37,19 +37,27 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <condition_variable>
+#include <cstddef>
 #include <cstring>
 #include <exception>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#ifndef INTEGRATECPP_NO_R_API
 #include <R_ext/Applic.h>
+#endif
 
 // TODO: comment calls to `noexcept(<cond>)` if `<cond>` is known to be `true`
 //       by `static_assert`.
@@ -75,6 +83,10 @@ namespace integratecpp {
  *   generated and passed to the `C`-level functions `Rdqag[is]`; exceptions in
  *   the `Callable` are temporarily caught, stored, and rethrown after returning
  *   to `C++` code.
+ * - Alternatively, the operator can be called with a vectorized `Callable`
+ *   invocable with arguments `const double *x`, `double *y`, and `int n`,
+ *   which writes the function values at the `n` abscissae `x` to `y`. It is
+ *   called once per rule application instead of once per abscissa.
  * - Integration results are returned in structs of type
  *   `integratecpp::integrator::return_type` with the approximated integral
  *   value, an estimated error, the final number of subdivisions, and the number
@@ -84,6 +96,10 @@ namespace integratecpp {
  *   integration may throw exceptions deriving from
  *   `integratecpp::integration_runtime_error`. Both have accessors to the
  *   result-state at error which can be used for error handling.
+ * - Alternatively to the `C`-level functions, a header-only port of the
+ *   underlying `QUADPACK` routines can be selected as backend via
+ *   `integratecpp::integrator::config_type`; see
+ *   `integratecpp::integrator::backend_type`.
  */
 class integrator {
    public:
@@ -139,6 +155,85 @@ class integrator {
         std::is_standard_layout<return_type>::value,
         "`integratecpp::integrator::return_type` not standard layout");
 
+    /*!
+     * \brief  Defines the backends for the numerical integration.
+     *
+     * - `r_api` calls the `C`-level functions `Rdqags` and `Rdqagi` from R's
+     *   C-API. Function evaluations pass through a callback function and
+     *   exceptions are rethrown after returning to `C++` code.
+     * - `native` uses a templated `C++` port of the same `QUADPACK` routines
+     *   (`dqags`, `dqagi`, `dqk21`, `dqk15i`, `dqpsrt`, and `dqelg`), which
+     *   allows the compiler to inline the integrand and does not require R.
+     *   Exceptions during function evaluations abort the integration
+     *   immediately.
+     * - `native_heap` uses the same port with the subintervals kept in a
+     *   binary heap of error estimates instead of a list in descending order
+     *   with linear insertion (`dqpsrt`). This avoids the quadratic cost in
+     *   `max_subdivisions` for integrands requiring many subdivisions.
+     *   Results may differ from `native` if error estimates are tied.
+     * - `native_qng` applies the nested Gauss-Kronrod-Patterson 10-, 21-, 43-,
+     *   and 87-point rules (`dqng`) to finite ranges first, reusing the
+     *   function values of the previous rules, and falls back to `native`,
+     *   adding the function evaluations, if the requested accuracy is not
+     *   achieved. This saves the adaptive bisection for smooth integrands.
+     *   Integrations with break points and `integrate_parallel()` use
+     *   `native`.
+     * - `native_qag` applies the Gauss-Kronrod rule with
+     *   `config_type::rule_points` points to finite ranges, bisecting the
+     *   subinterval with the largest error estimate without extrapolation
+     *   (`dqag` and `dqage`). Higher-order rules need fewer subdivisions for
+     *   smooth integrands, whereas integrands with singularities at the
+     *   bounds need the extrapolation of `native`, which is used for
+     *   infinite ranges, break points, and `integrate_parallel()`.
+     * - `native_double_exponential` applies the tanh-sinh rule to finite,
+     *   the exp-sinh rule to half-infinite, and the sinh-sinh rule to
+     *   infinite ranges, halving the step size of the trapezoidal rule in the
+     *   transformed variable up to `min(max_subdivisions, 9)` times while
+     *   reusing the function values of the previous levels. The error
+     *   estimate is accepted from the fourth level on, i.e., fewer levels do
+     *   not achieve the requested accuracy, and is the larger of the last two
+     *   level-to-level differences unless these decrease doubly
+     *   exponentially, e.g., for a kink within the range. The nodes are
+     *   computed once and shared across integrations. It converges rapidly
+     *   for integrands which are smooth in the interior, including algebraic
+     *   and logarithmic singularities at finite bounds, which are resolved up
+     *   to the spacing of doubles near the bound, i.e., best at zero, and
+     *   algebraically decaying tails; `subdivisions` reports the number of
+     *   levels. Break points and `integrate_parallel()` use `native`.
+     *
+     * If the macro `INTEGRATECPP_NO_R_API` is defined before including
+     * `integratecpp.h`, the header does not depend on R, `native` is the
+     * default backend, and using `r_api` is reported as invalid input.
+     */
+    enum class backend_type {
+        r_api,
+        native,
+        native_heap,
+        native_qng,
+        native_qag,
+        native_double_exponential
+    };
+
+    /*!
+     * \brief  Defines the status of an integration reported by
+     *         `integratecpp::integrator::try_integrate()` and per item by
+     *         `integratecpp::integrator::integrate_batch()`.
+     *
+     * The values `1` to `5` correspond to the error codes of `Rdqags` and
+     * `Rdqagi` and to the exceptions thrown by
+     * `integratecpp::integrator::operator()()`, e.g., `max_subdivisions` to
+     * `integratecpp::max_subdivision_error`.
+     */
+    enum class status_type {
+        success = 0,
+        max_subdivisions = 1,
+        roundoff = 2,
+        bad_integrand = 3,
+        extrapolation_roundoff = 4,
+        divergence = 5,
+        invalid_input = 6
+    };
+
     /*!
      * \brief  Defines a struct for the integration configuration parameters
      *         used in `integratecpp::integrator::operator()()`. Compare
@@ -177,6 +272,20 @@ class integrator {
          */
         int work_size{400};
 
+        //! \brief The backend used for the numerical integration.
+#ifdef INTEGRATECPP_NO_R_API
+        backend_type backend{backend_type::native};
+#else
+        backend_type backend{backend_type::r_api};
+#endif
+
+        /*!
+         * \brief The number of points of the Gauss-Kronrod rule of the
+         *        `native_qag` backend; ignored by the other backends.
+         * \pre `rule_points` is `15`, `21`, `31`, `41`, `51`, or `61`.
+         */
+        int rule_points{21};
+
         // NOTE: default constructor of `config_type` is technically
         //       `noexcept(false)` since `std::pow` is `noexcept(false)` as it
         //       might throw. however, for the values used it should not throw.
@@ -234,6 +343,52 @@ class integrator {
                                        const double relative_accuracy,
                                        const double absolute_accuracy,
                                        const int work_size) noexcept;
+
+        /*!
+         * \brief The full constructor including the backend.
+         *
+         * \param max_subdivisions   an `int` for the maximum number of
+         *                           subdivisions.
+         * \param relative_accuracy  a `double` for the requested relative
+         *                           accuracy.
+         * \param absolute_accuracy  a `double` for the requested absolute
+         *                           accuracy.
+         * \param work_size          an `int` for the size of the working array.
+         * \param backend            a `backend_type` for the backend.
+         *
+         * \warning   Preconditions for the configuration parameters are
+         *            unchecked upon construction.
+         */
+        explicit constexpr config_type(const int max_subdivisions,
+                                       const double relative_accuracy,
+                                       const double absolute_accuracy,
+                                       const int work_size,
+                                       const backend_type backend) noexcept;
+
+        /*!
+         * \brief The full constructor including the backend and the number of
+         *        points of the Gauss-Kronrod rule.
+         *
+         * \param max_subdivisions   an `int` for the maximum number of
+         *                           subdivisions.
+         * \param relative_accuracy  a `double` for the requested relative
+         *                           accuracy.
+         * \param absolute_accuracy  a `double` for the requested absolute
+         *                           accuracy.
+         * \param work_size          an `int` for the size of the working array.
+         * \param backend            a `backend_type` for the backend.
+         * \param rule_points        an `int` for the number of points of the
+         *                           Gauss-Kronrod rule of `native_qag`.
+         *
+         * \warning   Preconditions for the configuration parameters are
+         *            unchecked upon construction.
+         */
+        explicit constexpr config_type(const int max_subdivisions,
+                                       const double relative_accuracy,
+                                       const double absolute_accuracy,
+                                       const int work_size,
+                                       const backend_type backend,
+                                       const int rule_points) noexcept;
     };
     static_assert(std::is_nothrow_default_constructible<config_type>::value,
                   "`integratecpp::integrator::config_type` not nothrow "
@@ -258,6 +413,73 @@ class integrator {
         std::is_standard_layout<config_type>::value,
         "`integratecpp::integrator::config_type` not standard layout");
 
+    /*!
+     * \brief  Defines a class for the index and working arrays required by
+     *         `Rdqags` and `Rdqagi`. Compare
+     *         [`src/appl/integrate.c`](https://github.com/wch/r-source/blob/trunk/src/appl/integrate.c)
+     *         in R-source.
+     *
+     * A workspace can be passed to `integratecpp::integrator::operator()()` to
+     * reuse its arrays across calls. The arrays are only (re-)allocated if
+     * their capacities are smaller than required by the configuration
+     * parameters of a call, i.e., repeated integrations with the same
+     * configuration do not allocate after the first call.
+     *
+     * \warning   A workspace must not be used by multiple concurrent calls.
+     */
+    class workspace_type {
+       private:
+        //! \internal
+        //! \brief Index array of size `max_subdivisions`.
+        std::vector<int> iwork_{};
+        //! \internal
+        //! \brief Working array of size `work_size`.
+        std::vector<double> work_{};
+
+       public:
+        workspace_type() = default;
+
+        /*!
+         * \brief  A constructor allocating arrays according to the
+         *         configuration parameters.
+         *
+         * \param config  a `integratecpp::integrator::config_type`.
+         */
+        explicit workspace_type(const config_type &config);
+
+        /*!
+         * \brief  Ensures that the capacities of the arrays suffice for the
+         *         configuration parameters; never shrinks the arrays.
+         *
+         * \param config  a `integratecpp::integrator::config_type`.
+         */
+        void reserve(const config_type &config);
+
+        //! \brief Accessor to the capacity of the index array.
+        int max_subdivisions() const noexcept;
+
+        //! \brief Accessor to the capacity of the working array.
+        int work_size() const noexcept;
+
+        //! \cond INTERNAL
+
+        //! \internal
+        //! \brief Accessor to the index array.
+        int *iwork() noexcept;
+
+        //! \internal
+        //! \brief Accessor to the working array.
+        double *work() noexcept;
+
+        //! \endcond
+    };
+    static_assert(std::is_nothrow_move_constructible<workspace_type>::value,
+                  "`integratecpp::integrator::workspace_type` not nothrow "
+                  "move-constructible");
+    static_assert(std::is_nothrow_move_assignable<workspace_type>::value,
+                  "`integratecpp::integrator::workspace_type` not nothrow "
+                  "move-assignable");
+
    private:
     //! \internal
     //! \brief Configuration parameter for numerical integration.
@@ -370,6 +592,23 @@ class integrator {
     //! \brief Setter to the dimensioning parameter of the working array.
     void work_size(const int work_size) noexcept;
 
+    //! \internal
+    //! \brief Accessor to the backend.
+    constexpr auto backend() const noexcept -> decltype(config_.backend);
+
+    //! \internal
+    //! \brief Setter to the backend.
+    void backend(const backend_type backend) noexcept;
+
+    //! \internal
+    //! \brief Accessor to the number of points of the Gauss-Kronrod rule.
+    constexpr auto rule_points() const noexcept
+        -> decltype(config_.rule_points);
+
+    //! \internal
+    //! \brief Setter to the number of points of the Gauss-Kronrod rule.
+    void rule_points(const int rule_points) noexcept;
+
     //! \endcond
 
     /*!
@@ -378,10 +617,13 @@ class integrator {
      *         `Rdqagi` of at least one of the bounds is infinite.
      *
      * \tparam UnaryRealFunction_  A `Callable` type invocable with
-     *                             `const double` and returning `double`.
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
      *
      * \param fn     a `UnaryRealFunction_` functor compatible with a
-     *               `const double` signature.
+     *               `const double` signature or a vectorized functor
+     *               evaluating `n` abscissae `x` into `y` at once.
      * \param lower  a `double` for the lower bound.
      * \param upper  a `double` for the upper bound.
      *
@@ -410,6 +652,414 @@ class integrator {
     template <typename UnaryRealFunction_>
     return_type operator()(UnaryRealFunction_ &&fn, const double lower,
                            const double upper) const;
+
+    /*!
+     * \brief  Approximates an integral numerically for a functor, lower, and
+     *         upper bound, using `Rdqags` if both bounds are are finite and
+     *         `Rdqagi` of at least one of the bounds is infinite. The index
+     *         and working arrays are taken from a reusable workspace.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn         a `UnaryRealFunction_` functor compatible with a
+     *                   `const double` signature.
+     * \param lower      a `double` for the lower bound.
+     * \param upper      a `double` for the upper bound.
+     * \param workspace  a `integratecpp::integrator::workspace_type`, which
+     *                   is enlarged if its capacities are insufficient.
+     *
+     * \return       a `integratecpp::integrator::return_type` with the
+     *               integration results.
+     *
+     * \exception    throws the same exceptions as
+     *               `integratecpp::integrator::operator()()` without
+     *               workspace.
+     */
+    template <typename UnaryRealFunction_>
+    return_type operator()(UnaryRealFunction_ &&fn, const double lower,
+                           const double upper,
+                           workspace_type &workspace) const;
+
+    /*!
+     * \brief  Approximates an integral numerically for a functor, finite lower
+     *         and upper bound, and interior break points, e.g., kinks or
+     *         discontinuities of the integrand, using the header-only port of
+     *         `dqagp`.
+     *
+     * The subintervals between the sorted break points are the initial
+     * subintervals, i.e., they count towards `max_subdivisions`. The rules are
+     * always those of the header-only `QUADPACK` port, i.e., the backend is
+     * ignored. Without break points, the integral is approximated as by
+     * `integratecpp::integrator::operator()()` without break points.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn      a `UnaryRealFunction_` functor compatible with a
+     *                `const double` signature.
+     * \param lower   a `double` for the lower bound.
+     * \param upper   a `double` for the upper bound.
+     * \param points  a `std::vector<double>` of break points between `lower`
+     *                and `upper` in any order.
+     *
+     * \return       a `integratecpp::integrator::return_type` with the
+     *               integration results.
+     *
+     * \exception    throws integratecpp::invalid_input_error if configuration
+     *               parameters' preconditions are not fulfilled, if a bound is
+     *               not finite, if a break point is not between `lower` and
+     *               `upper`, or if `max_subdivisions` is less than the number
+     *               of initial subintervals.
+     * \exception    throws the same integration errors as
+     *               `integratecpp::integrator::operator()()` without break
+     *               points.
+     */
+    template <typename UnaryRealFunction_>
+    return_type operator()(UnaryRealFunction_ &&fn, const double lower,
+                           const double upper,
+                           const std::vector<double> &points) const;
+
+    /*!
+     * \brief  Approximates an integral numerically for a functor, finite lower
+     *         and upper bound, and interior break points using the
+     *         header-only port of `dqagp`. The index and working arrays are
+     *         taken from a reusable workspace.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn         a `UnaryRealFunction_` functor compatible with a
+     *                   `const double` signature.
+     * \param lower      a `double` for the lower bound.
+     * \param upper      a `double` for the upper bound.
+     * \param points     a `std::vector<double>` of break points between
+     *                   `lower` and `upper` in any order.
+     * \param workspace  a `integratecpp::integrator::workspace_type`, which
+     *                   is enlarged if its capacities are insufficient.
+     *
+     * \return       a `integratecpp::integrator::return_type` with the
+     *               integration results.
+     *
+     * \exception    throws the same exceptions as
+     *               `integratecpp::integrator::operator()()` with break points
+     *               and without workspace.
+     */
+    template <typename UnaryRealFunction_>
+    return_type operator()(UnaryRealFunction_ &&fn, const double lower,
+                           const double upper,
+                           const std::vector<double> &points,
+                           workspace_type &workspace) const;
+
+    /*!
+     * \brief  Approximates an integral numerically for a functor, lower, and
+     *         upper bound like `integratecpp::integrator::operator()()`, but
+     *         reports integration errors and invalid input by a status instead
+     *         of throwing.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn     a `UnaryRealFunction_` functor compatible with a
+     *               `const double` signature.
+     * \param lower  a `double` for the lower bound.
+     * \param upper  a `double` for the upper bound.
+     * \param out    a `integratecpp::integrator::return_type` for the
+     *               integration results, i.e., the results at the time of error
+     *               for integration errors.
+     *
+     * \return       a `integratecpp::integrator::status_type`;
+     *               `status_type::invalid_input` if configuration parameters'
+     *               preconditions are not fulfilled or a bound is `NaN`.
+     *
+     * \exception    throws integratecpp::integration_runtime_error if the
+     *               `Callable` returns infinite values.
+     * \exception    rethrows caught exceptions that occur during the evaluation
+     *               of the `Callable`.
+     */
+    template <typename UnaryRealFunction_>
+    status_type try_integrate(UnaryRealFunction_ &&fn, const double lower,
+                              const double upper, return_type &out) const;
+
+    /*!
+     * \brief  Approximates an integral numerically for a functor, lower, and
+     *         upper bound, reporting integration errors and invalid input by a
+     *         status instead of throwing. The index and working arrays are
+     *         taken from a reusable workspace.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn         a `UnaryRealFunction_` functor compatible with a
+     *                   `const double` signature.
+     * \param lower      a `double` for the lower bound.
+     * \param upper      a `double` for the upper bound.
+     * \param out        a `integratecpp::integrator::return_type` for the
+     *                   integration results.
+     * \param workspace  a `integratecpp::integrator::workspace_type`, which
+     *                   is enlarged if its capacities are insufficient.
+     *
+     * \return       a `integratecpp::integrator::status_type`.
+     *
+     * \exception    throws the same exceptions as
+     *               `integratecpp::integrator::try_integrate()` without
+     *               workspace.
+     */
+    template <typename UnaryRealFunction_>
+    status_type try_integrate(UnaryRealFunction_ &&fn, const double lower,
+                              const double upper, return_type &out,
+                              workspace_type &workspace) const;
+
+    /*!
+     * \brief  Approximates integrals numerically for a functor over arrays of
+     *         lower and upper bounds, reporting integration errors per item
+     *         instead of throwing. The configuration parameters are validated
+     *         once and a single workspace is used for all items.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn      a `UnaryRealFunction_` functor compatible with a
+     *                `const double` signature.
+     * \param lower   a pointer to `n` lower bounds.
+     * \param upper   a pointer to `n` upper bounds.
+     * \param n       a `std::size_t` for the number of items.
+     * \param out     a pointer to `n` `integratecpp::integrator::return_type`
+     *                for the integration results, i.e., the results at the
+     *                time of error for items with errors.
+     * \param status  a pointer to `n`
+     *                `integratecpp::integrator::status_type` for the status
+     *                of the items; `status_type::invalid_input` for items
+     *                with `NaN` bounds.
+     *
+     * \exception    throws integratecpp::invalid_input_error if configuration
+     *               parameters' preconditions are not fulfilled.
+     * \exception    throws integratecpp::integration_runtime_error if the
+     *               `Callable` returns infinite values.
+     * \exception    rethrows caught exceptions that occur during the evaluation
+     *               of the `Callable`; the results of the remaining items are
+     *               unspecified.
+     */
+    template <typename UnaryRealFunction_>
+    void integrate_batch(UnaryRealFunction_ &&fn, const double *lower,
+                         const double *upper, const std::size_t n,
+                         return_type *out, status_type *status) const;
+
+    /*!
+     * \brief  Approximates integrals numerically for a functor over arrays of
+     *         lower and upper bounds, reporting integration errors per item
+     *         instead of throwing. The index and working arrays are taken from
+     *         a reusable workspace.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn         a `UnaryRealFunction_` functor compatible with a
+     *                   `const double` signature.
+     * \param lower      a pointer to `n` lower bounds.
+     * \param upper      a pointer to `n` upper bounds.
+     * \param n          a `std::size_t` for the number of items.
+     * \param out        a pointer to `n`
+     *                   `integratecpp::integrator::return_type` for the
+     *                   integration results.
+     * \param status     a pointer to `n`
+     *                   `integratecpp::integrator::status_type` for the status
+     *                   of the items.
+     * \param workspace  a `integratecpp::integrator::workspace_type`, which
+     *                   is enlarged if its capacities are insufficient.
+     *
+     * \exception    throws the same exceptions as
+     *               `integratecpp::integrator::integrate_batch()` without
+     *               workspace.
+     */
+    template <typename UnaryRealFunction_>
+    void integrate_batch(UnaryRealFunction_ &&fn, const double *lower,
+                         const double *upper, const std::size_t n,
+                         return_type *out, status_type *status,
+                         workspace_type &workspace) const;
+
+    /*!
+     * \brief  Approximates integrals numerically for a functor over vectors
+     *         of lower and upper bounds, reporting integration errors per item
+     *         instead of throwing.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn      a `UnaryRealFunction_` functor compatible with a
+     *                `const double` signature.
+     * \param lower   a `std::vector<double>` of lower bounds.
+     * \param upper   a `std::vector<double>` of upper bounds of the same size.
+     * \param out     a `std::vector<integratecpp::integrator::return_type>`,
+     *                resized to the number of items, for the integration
+     *                results.
+     * \param status  a `std::vector<integratecpp::integrator::status_type>`,
+     *                resized to the number of items, for the status of the
+     *                items.
+     *
+     * \exception    throws integratecpp::invalid_input_error if the sizes of
+     *               `lower` and `upper` differ.
+     * \exception    throws the same exceptions as
+     *               `integratecpp::integrator::integrate_batch()` for arrays.
+     */
+    template <typename UnaryRealFunction_>
+    void integrate_batch(UnaryRealFunction_ &&fn,
+                         const std::vector<double> &lower,
+                         const std::vector<double> &upper,
+                         std::vector<return_type> &out,
+                         std::vector<status_type> &status) const;
+
+    /*!
+     * \brief  Approximates integrals numerically for a functor over arrays of
+     *         lower and upper bounds concurrently, capturing errors per item.
+     *
+     * The items are distributed across a pool of threads by work stealing,
+     * each thread with its own workspace. The configuration parameters are
+     * validated once. Exceptions are not propagated but stored per item:
+     * integration errors as the exceptions thrown by
+     * `integratecpp::integrator::operator()()`, e.g.,
+     * `integratecpp::max_subdivision_error`, and exceptions during the
+     * evaluation of the `Callable` as thrown.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn            a `UnaryRealFunction_` functor compatible with a
+     *                      `const double` signature, which is invoked
+     *                      concurrently.
+     * \param lower         a pointer to `n` lower bounds.
+     * \param upper         a pointer to `n` upper bounds.
+     * \param n             a `std::size_t` for the number of items.
+     * \param out           a pointer to `n`
+     *                      `integratecpp::integrator::return_type` for the
+     *                      integration results.
+     * \param errors        a pointer to `n` `std::exception_ptr` for the
+     *                      errors of the items; empty for successful items.
+     * \param thread_count  an `int` for the number of threads including the
+     *                      calling thread; `0` for
+     *                      `std::thread::hardware_concurrency()`.
+     *
+     * \exception    throws integratecpp::invalid_input_error if configuration
+     *               parameters' preconditions are not fulfilled or
+     *               `thread_count` is negative.
+     *
+     * \warning      With the `r_api` backend, the `Callable` must not call R's
+     *               C-API.
+     */
+    template <typename UnaryRealFunction_>
+    void integrate_batch_parallel(UnaryRealFunction_ &&fn, const double *lower,
+                                  const double *upper, const std::size_t n,
+                                  return_type *out, std::exception_ptr *errors,
+                                  const int thread_count = 0) const;
+
+    /*!
+     * \brief  Approximates integrals numerically for a functor over vectors
+     *         of lower and upper bounds concurrently, capturing errors per
+     *         item.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn            a `UnaryRealFunction_` functor compatible with a
+     *                      `const double` signature, which is invoked
+     *                      concurrently.
+     * \param lower         a `std::vector<double>` of lower bounds.
+     * \param upper         a `std::vector<double>` of upper bounds of the same
+     *                      size.
+     * \param out           a
+     *                      `std::vector<integratecpp::integrator::return_type>`,
+     *                      resized to the number of items, for the
+     *                      integration results.
+     * \param errors        a `std::vector<std::exception_ptr>`, resized to the
+     *                      number of items, for the errors of the items.
+     * \param thread_count  an `int` for the number of threads including the
+     *                      calling thread; `0` for
+     *                      `std::thread::hardware_concurrency()`.
+     *
+     * \exception    throws integratecpp::invalid_input_error if the sizes of
+     *               `lower` and `upper` differ.
+     * \exception    throws the same exceptions as
+     *               `integratecpp::integrator::integrate_batch_parallel()` for
+     *               arrays.
+     */
+    template <typename UnaryRealFunction_>
+    void integrate_batch_parallel(UnaryRealFunction_ &&fn,
+                                  const std::vector<double> &lower,
+                                  const std::vector<double> &upper,
+                                  std::vector<return_type> &out,
+                                  std::vector<std::exception_ptr> &errors,
+                                  const int thread_count = 0) const;
+
+    /*!
+     * \brief  Approximates an integral numerically for a functor, lower, and
+     *         upper bound, evaluating the integrand concurrently. Intended for
+     *         integrands which are expensive to evaluate.
+     *
+     * Instead of `Rdqags` and `Rdqagi`, a globally adaptive scheme without
+     * extrapolation (as `dqage`) is used, which bisects the `bisections`
+     * subintervals with the largest error estimates at once and applies the
+     * Gauss-Kronrod rules of `Rdqags` and `Rdqagi` to the new subintervals
+     * concurrently on a pool of threads. The results depend on `bisections`
+     * but not on `thread_count`. The rules are always those of the header-only
+     * `QUADPACK` port, i.e., the backend is ignored.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn            a `UnaryRealFunction_` functor compatible with a
+     *                      `const double` signature, which is invoked
+     *                      concurrently.
+     * \param lower         a `double` for the lower bound.
+     * \param upper         a `double` for the upper bound.
+     * \param thread_count  an `int` for the number of threads including the
+     *                      calling thread; `0` for
+     *                      `std::thread::hardware_concurrency()`.
+     * \param bisections    an `int` for the number of subintervals bisected
+     *                      at once.
+     *
+     * \return       a `integratecpp::integrator::return_type` with the
+     *               integration results.
+     *
+     * \exception    throws integratecpp::invalid_input_error if configuration
+     *               parameters' preconditions are not fulfilled, if
+     *               `thread_count` is negative, or if `bisections` is not
+     *               positive.
+     * \exception    throws integratecpp::max_subdivision_error,
+     *               integratecpp::roundoff_error, and
+     *               integratecpp::bad_integrand_error as
+     *               `integratecpp::integrator::operator()()` and
+     *               integratecpp::divergence_error if the approximations
+     *               overflow.
+     * \exception    rethrows caught exceptions that occur during the evaluation
+     *               of the `Callable`.
+     */
+    template <typename UnaryRealFunction_>
+    return_type integrate_parallel(UnaryRealFunction_ &&fn, const double lower,
+                                   const double upper,
+                                   const int thread_count = 0,
+                                   const int bisections = 16) const;
 };
 static_assert(std::is_nothrow_default_constructible<integrator>::value,
               "`integratecpp::integrator::integrator` not nothrow "
@@ -436,7 +1086,9 @@ static_assert(std::is_standard_layout<integrator>::value,
  *         and `Rdqagi` of at least one of the bounds is infinite.
  *
  * \tparam UnaryRealFunction_  A `Callable` type invocable with `const double`
- *                             and returning `double`.
+ *                             and returning `double`, or a vectorized
+ *                             `Callable` type invocable with `const double *`,
+ *                             `double *`, and `int`.
  *
  * \param fn      a `UnaryRealFunction_` functor compatible with a `const
  *                double` signature.
@@ -474,27 +1126,250 @@ integrator::return_type integrate(UnaryRealFunction_ &&fn, const double lower,
                                   const integrator::config_type config = {});
 
 /*!
- * \brief  Defines a type of object to be thrown as exception. It reports errors
- *         that occur during the integration routine of
- *         `integratecpp::integrator::operator()()` and are due to events beyond
- *         the scope of the program and not easily predicted.
+ * \brief  A drop-in replacement of `integratecpp::integrator` for numerical
+ *         integration with a reusable workspace. Approximates an integral
+ *         numerically for a functor, lower, and upper bound, using `Rdqags` if
+ *         both bounds are are finite and `Rdqagi` of at least one of the bounds
+ *         is infinite.
+ *
+ * \tparam UnaryRealFunction_  A `Callable` type invocable with `const double`
+ *                             and returning `double`, or a vectorized
+ *                             `Callable` type invocable with `const double *`,
+ *                             `double *`, and `int`.
+ *
+ * \param fn         a `UnaryRealFunction_` functor compatible with a `const
+ *                   double` signature.
+ * \param lower      a `double` for the lower bound.
+ * \param upper      a `double` for the upper bound.
+ * \param config     a `const` reference to a
+ *                   `integratecpp::integrator::config_type` configuration
+ *                   parameter.
+ * \param workspace  a `integratecpp::integrator::workspace_type`, which is
+ *                   enlarged if its capacities are insufficient.
+ *
+ * \return        a `integratecpp::integrator::return_type` with the
+ *                integration results.
+ *
+ * \exception    throws the same exceptions as `integratecpp::integrate()`
+ *               without workspace.
  */
-class integration_runtime_error : public std::runtime_error {
+template <typename UnaryRealFunction_>
+integrator::return_type integrate(UnaryRealFunction_ &&fn, const double lower,
+                                  const double upper,
+                                  const integrator::config_type &config,
+                                  integrator::workspace_type &workspace);
+
+/*!
+ * \brief  Defines a functor wrapping the `C`-level functions `Rdqags` and
+ *         `Rdqagi` like `integratecpp::integrator`, with the maximum number of
+ *         subdivisions and the size of the working array fixed at compile time.
+ *
+ * - The index and working arrays are stored in `std::array`s on the stack of
+ *   `integratecpp::static_integrator::operator()()`, i.e., integrations do not
+ *   allocate heap memory. This is intended for small numbers of subdivisions.
+ * - Preconditions on `MaxSubdivisions_` and `WorkSize_` are checked by
+ *   `static_assert` and preconditions on the requested accuracies are checked
+ *   upon construction and setting. Hence, only the bounds are validated on
+ *   calls to `integratecpp::static_integrator::operator()()`.
+ * - Integration results and exceptions are the same as for
+ *   `integratecpp::integrator`.
+ *
+ * \tparam MaxSubdivisions_  an `int` for the maximum number of subdivisions.
+ * \tparam WorkSize_         an `int` for the size of the working array.
+ */
+template <int MaxSubdivisions_, int WorkSize_ = 4 * MaxSubdivisions_>
+class static_integrator {
+    static_assert(MaxSubdivisions_ >= 1,
+                  "`MaxSubdivisions_` must be larger or equal to one");
+    static_assert(WorkSize_ >= 4 * MaxSubdivisions_,
+                  "`WorkSize_` must be larger or equal to four times "
+                  "`MaxSubdivisions_`");
+
+   public:
+    //! \brief The type of the integration results.
+    using return_type = integrator::return_type;
+    //! \brief The type of the integration configuration parameters.
+    using config_type = integrator::config_type;
+    //! \brief The type of the backends for the numerical integration.
+    using backend_type = integrator::backend_type;
+
    private:
-    integrator::return_type result_{};
+    //! \internal
+    //! \brief The requested relative accuracy.
+    double relative_accuracy_{config_type{}.relative_accuracy};
+    //! \internal
+    //! \brief The requested absolute accuracy.
+    double absolute_accuracy_{config_type{}.absolute_accuracy};
+    //! \internal
+    //! \brief The backend used for the numerical integration.
+    backend_type backend_{config_type{}.backend};
+    //! \internal
+    //! \brief The number of points of the Gauss-Kronrod rule of `native_qag`.
+    int rule_points_{config_type{}.rule_points};
 
    public:
-    using std::runtime_error::runtime_error;
+    static_integrator() noexcept = default;
 
     /*!
-     * \brief  A full constructor, specifying the error message with
-     *         `std::string`.
+     * \brief  A constructor using `relative_accuracy`.
      *
-     * \param  what     a `std::string` containing the error message.
-     * \param  result   a `integratecpp::integrator::return_type` with
-     *                  the integration results at the time of error.
+     * \param relative_accuracy  a `double` for the requested relative accuracy.
+     *
+     * \exception  throws integratecpp::invalid_input_error if the requested
+     *             accuracies' preconditions are not fulfilled.
      */
-    explicit integration_runtime_error(const std::string what,
+    explicit static_integrator(const double relative_accuracy);
+
+    /*!
+     * \brief  A constructor using `relative_accuracy` and `absolute_accuracy`.
+     *
+     * \param relative_accuracy  a `double` for the requested relative accuracy.
+     * \param absolute_accuracy  a `double` for the requested absolute accuracy.
+     *
+     * \exception  throws integratecpp::invalid_input_error if the requested
+     *             accuracies' preconditions are not fulfilled.
+     */
+    explicit static_integrator(const double relative_accuracy,
+                               const double absolute_accuracy);
+
+    /*!
+     * \brief  A constructor using `relative_accuracy`, `absolute_accuracy`,
+     *         and `backend`.
+     *
+     * \param relative_accuracy  a `double` for the requested relative accuracy.
+     * \param absolute_accuracy  a `double` for the requested absolute accuracy.
+     * \param backend            a `backend_type` for the backend.
+     *
+     * \exception  throws integratecpp::invalid_input_error if the requested
+     *             accuracies' or the backend's preconditions are not
+     *             fulfilled.
+     */
+    explicit static_integrator(const double relative_accuracy,
+                               const double absolute_accuracy,
+                               const backend_type backend);
+
+    /*!
+     * \brief  A constructor using `relative_accuracy`, `absolute_accuracy`,
+     *         `backend`, and `rule_points`.
+     *
+     * \param relative_accuracy  a `double` for the requested relative accuracy.
+     * \param absolute_accuracy  a `double` for the requested absolute accuracy.
+     * \param backend            a `backend_type` for the backend.
+     * \param rule_points        an `int` for the number of points of the
+     *                           Gauss-Kronrod rule of `native_qag`.
+     *
+     * \exception  throws integratecpp::invalid_input_error if the requested
+     *             accuracies', the backend's, or the number of points'
+     *             preconditions are not fulfilled.
+     */
+    explicit static_integrator(const double relative_accuracy,
+                               const double absolute_accuracy,
+                               const backend_type backend,
+                               const int rule_points);
+
+    //! \brief Accessor for the configuration parameters.
+    constexpr config_type config() const noexcept;
+
+    //! \brief Accessor to the maximum number of subdivisions.
+    static constexpr int max_subdivisions() noexcept;
+
+    //! \brief Accessor to the requested relative accuracy.
+    constexpr double relative_accuracy() const noexcept;
+
+    /*!
+     * \brief  Setter to the requested relative accuracy.
+     *
+     * \exception  throws integratecpp::invalid_input_error if the requested
+     *             accuracies' preconditions are not fulfilled; the object is
+     *             left unchanged.
+     */
+    void relative_accuracy(const double relative_accuracy);
+
+    //! \brief Accessor to the requested absolute accuracy.
+    constexpr double absolute_accuracy() const noexcept;
+
+    /*!
+     * \brief  Setter to the requested absolute accuracy.
+     *
+     * \exception  throws integratecpp::invalid_input_error if the requested
+     *             accuracies' preconditions are not fulfilled; the object is
+     *             left unchanged.
+     */
+    void absolute_accuracy(const double absolute_accuracy);
+
+    //! \brief Accessor to the dimensioning parameter of the working array.
+    static constexpr int work_size() noexcept;
+
+    //! \brief Accessor to the backend.
+    constexpr backend_type backend() const noexcept;
+
+    /*!
+     * \brief  Setter to the backend.
+     *
+     * \exception  throws integratecpp::invalid_input_error if the backend is
+     *             not available; the object is left unchanged.
+     */
+    void backend(const backend_type backend);
+
+    //! \brief Accessor to the number of points of the Gauss-Kronrod rule.
+    constexpr int rule_points() const noexcept;
+
+    /*!
+     * \brief  Setter to the number of points of the Gauss-Kronrod rule.
+     *
+     * \exception  throws integratecpp::invalid_input_error if the number of
+     *             points is not supported; the object is left unchanged.
+     */
+    void rule_points(const int rule_points);
+
+    /*!
+     * \brief  Approximates an integral numerically for a functor, lower, and
+     *         upper bound, using `Rdqags` if both bounds are are finite and
+     *         `Rdqagi` of at least one of the bounds is infinite.
+     *
+     * \tparam UnaryRealFunction_  A `Callable` type invocable with
+     *                             `const double` and returning `double`, or
+     *                             a vectorized `Callable` type invocable with
+     *                             `const double *`, `double *`, and `int`.
+     *
+     * \param fn     a `UnaryRealFunction_` functor compatible with a
+     *               `const double` signature.
+     * \param lower  a `double` for the lower bound.
+     * \param upper  a `double` for the upper bound.
+     *
+     * \return       a `integratecpp::integrator::return_type` with the
+     *               integration results.
+     *
+     * \exception    throws the same exceptions as
+     *               `integratecpp::integrator::operator()()`.
+     */
+    template <typename UnaryRealFunction_>
+    return_type operator()(UnaryRealFunction_ &&fn, const double lower,
+                           const double upper) const;
+};
+
+/*!
+ * \brief  Defines a type of object to be thrown as exception. It reports errors
+ *         that occur during the integration routine of
+ *         `integratecpp::integrator::operator()()` and are due to events beyond
+ *         the scope of the program and not easily predicted.
+ */
+class integration_runtime_error : public std::runtime_error {
+   private:
+    integrator::return_type result_{};
+
+   public:
+    using std::runtime_error::runtime_error;
+
+    /*!
+     * \brief  A full constructor, specifying the error message with
+     *         `std::string`.
+     *
+     * \param  what     a `std::string` containing the error message.
+     * \param  result   a `integratecpp::integrator::return_type` with
+     *                  the integration results at the time of error.
+     */
+    explicit integration_runtime_error(const std::string what,
                                        const integrator::return_type &result);
 
     /*!
@@ -692,266 +1567,4490 @@ struct is_invocable_r
 };
 #endif
 
+/*!
+ * \internal
+ *
+ * \brief    Determines whether `Fn` is a vectorized integrand, i.e., can be
+ *           invoked with `const double *x`, `double *y`, and `int n` to write
+ *           the function values at the `n` abscissae `x` to `y`.
+ *
+ * \tparam   Fn      `Callable` type.
+ */
+template <typename Fn>
+struct is_vectorized_integrand
+    : is_invocable<Fn, const double *, double *, int> {};
+
+/*!
+ * \internal
+ *
+ * \brief    Determines whether `Fn` is a valid integrand, i.e., either
+ *           invocable with `const double` and returning `double` or a
+ *           vectorized integrand.
+ *
+ * \tparam   Fn      `Callable` type.
+ */
+template <typename Fn>
+struct is_integrand
+    : std::integral_constant<bool,
+                             is_invocable_r<double, Fn, const double>::value ||
+                                 is_vectorized_integrand<Fn>::value> {};
+
 }  // namespace type_traits
 
 //! \endcond
 
 // -----------------------------------------------------------------------------
-// Implementations of integratecpp::integrator::operator()(...)
+// Implementations of the QUADPACK port in integratecpp::quadpack
 // -----------------------------------------------------------------------------
 
-template <typename UnaryRealFunction_>
-inline integrator::return_type integrator::operator()(UnaryRealFunction_ &&fn,
-                                                      double lower,
-                                                      double upper) const {
-    static_assert(
-        type_traits::is_invocable_r<
-            double, typename std::remove_reference<UnaryRealFunction_>::type,
-            const double>::value,
-        "`UnaryRealFunction_` is not invocable with `const double` and return "
-        "value `double`");
-
-    // NOTE: check validity of configuration parameters
-    const auto throw_if_invalid_config = [](const config_type config) {
-        if (config.max_subdivisions <= 0) {
-            throw invalid_input_error("the input is invalid");
-        } else if (config.absolute_accuracy <= 0. &&
-                   config.relative_accuracy <
-                       std::max(50. * std::numeric_limits<double>::epsilon(),
-                                0.5e-28)) {
-            throw invalid_input_error("the input is invalid");
-        } else if (config.work_size < 4 * config.max_subdivisions) {
-            throw invalid_input_error("the input is invalid");
-        } else {
-            return;
-        }
-    };
-    throw_if_invalid_config(config_);
-    // NOTE: check validity of bounds
-    const auto throw_if_invalid_bounds = [](const double lower,
-                                            const double upper) {
-        if (std::isnan(lower) || std::isnan(upper)) {
-            throw invalid_input_error("the input is invalid");
-        } else {
-            return;
-        }
-    };
-    throw_if_invalid_bounds(lower, upper);
+//! \cond INTERNAL
+namespace quadpack {
 
-    // NOTE: create local copies for input variables and references to an
-    // instance of output variables (as `Rdqag[si]` interface requires pointers
-    // to non-const variables). use names as described in the API of
-    // `Rdqag[is]`.
-    auto limit = config_.max_subdivisions;
-    auto epsrel = config_.relative_accuracy;
-    auto epsabs = config_.absolute_accuracy;
-    auto lenw = config_.work_size;
+/*!
+ * \internal
+ *
+ * \brief    A templated `C++` port of the `QUADPACK` routines used by `Rdqags`
+ *           and `Rdqagi`, following the translation in
+ *           [`src/appl/integrate.c`](https://github.com/wch/r-source/blob/trunk/src/appl/integrate.c)
+ *           in R-source operation by operation to reproduce its results.
+ *
+ * The integrand is a `Callable` invocable with `double *x` and `int n`, which
+ * replaces the `n` abscissae in `x` by the function values, i.e., it has the
+ * same semantics as `integr_fn` without the `void *` argument. Indices of
+ * subintervals stored in `iord` are one-based as in the `Fortran` original.
+ */
 
-    auto out = return_type{};  // NOTE: construct returned object
-    auto &result = out.value;
-    auto &abserr = out.absolute_error;
-    auto &last = out.subdivisions;
-    auto &neval = out.neval;
+//! \internal
+//! \brief The relative machine accuracy.
+inline constexpr double epmach() noexcept {
+    return std::numeric_limits<double>::epsilon();
+}
 
-    // NOTE: create variable for error code of `Rdqag[si]`
-    auto ier = 0;
+//! \internal
+//! \brief The smallest positive magnitude.
+inline constexpr double uflow() noexcept {
+    return std::numeric_limits<double>::min();
+}
 
-    // NOTE: create working array and index array
-    auto iwork = std::vector<int>(limit);
-    auto work = std::vector<double>(lenw);
+//! \internal
+//! \brief The largest positive magnitude.
+inline constexpr double oflow() noexcept {
+    return std::numeric_limits<double>::max();
+}
 
-    // NOTE: create non-capturing callback Lambda (which can be implicitly
-    // converted to a function.-pointer of signature `integr_fn` aka
-    // `void(double *, int, void *)`).
-    // the actual integrand function is passed through the `void *` in the last
-    // argument alongside with a `std::unique_ptr` to capture exceptions during
-    // function evaluations.
-    const auto integrand_callback = [](double *x, int n, void *ex) {
-        using iterator = double *;
-        using const_iterator = const double *;
-        const auto cbegin = [](const double *x) {
-            return static_cast<const_iterator>(&x[0]);
-        };
-        const auto cend = [](const double *x, const int n) {
-            return static_cast<const_iterator>(&x[n]);
-        };
-        const auto begin = [](double *x) {
-            return static_cast<iterator>(&x[0]);
-        };
-        using ex_t =
-            std::pair<typename std::remove_reference<UnaryRealFunction_>::type,
-                      std::exception_ptr>;
-
-        auto &fn_integrand = (*static_cast<ex_t *>(ex)).first;
-        auto &e_ptr = (*static_cast<ex_t *>(ex)).second;
+/*!
+ * \internal
+ *
+ * \brief    Computes the 21-point Gauss-Kronrod rule on a finite interval
+ *           (`dqk21`).
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    resabs  the approximated integral of `|f|`.
+ * \param    resasc  the approximated integral of `|f - I / (b - a)|`.
+ */
+template <typename Integrand_>
+inline void qk21(Integrand_ &f, const double a, const double b, double &result,
+                 double &abserr, double &resabs, double &resasc) {
+    static constexpr double wg[5] = {
+        .066671344308688137593568809893332, .149451349150580593145776339657697,
+        .219086362515982043995534934228163, .269266719309996355091226921569469,
+        .295524224714752870173892994651338};
+    static constexpr double xgk[11] = {.995657163025808080735527280689003,
+                                       .973906528517171720077964012084452,
+                                       .930157491355708226001207180059508,
+                                       .865063366688984510732096688423493,
+                                       .780817726586416897063717578345042,
+                                       .679409568299024406234327365114874,
+                                       .562757134668604683339000099272694,
+                                       .433395394129247190799265943165784,
+                                       .294392862701460198131126603103866,
+                                       .14887433898163121088482600112972,
+                                       0.};
+    static constexpr double wgk[11] = {.011694638867371874278064396062192,
+                                       .03255816230796472747881897245939,
+                                       .05475589657435199603138130024458,
+                                       .07503967481091995276704314091619,
+                                       .093125454583697605535065465083366,
+                                       .109387158802297641899210590325805,
+                                       .123491976262065851077208745526708,
+                                       .134709217311473325928054001771707,
+                                       .142775938577060080797094273138717,
+                                       .147739104901338491374841515972068,
+                                       .149445554002916905664936468389821};
 
-        // NOTE: `guarded_transform` is a wrapper around `std::transform`,
-        // catching all exceptions apart `std::bad_alloc` and storing them in
-        // the provided `std::exception_ptr`. an additional check is performed
-        // whether all results are finite. in case of errors, all function
-        // values are set to zero.
-        const auto guarded_transform =
-            [](const_iterator first, const_iterator last, iterator d_first,
-               typename std::remove_reference<UnaryRealFunction_>::type &fn,
-               std::exception_ptr &e_ptr) {
-                const auto cleanup = [](iterator first, std::size_t size) {
-                    try {
-                        std::fill_n(first, size, 0.);
-                    } catch (...) {
-                    }
-                };
-                try {
-                    std::transform(first, last, d_first, fn);
-                } catch (const std::bad_alloc &e) {
-                    // NOTE: memory allocation issues inside std::transform must
-                    // not be ignored
-                    std::rethrow_exception(std::current_exception());
-                } catch (const std::exception &e) {
-                    cleanup(d_first, std::distance(first, last));
-                    e_ptr = std::current_exception();
-                } catch (...) {
-                    cleanup(d_first, std::distance(first, last));
-                    e_ptr = std::make_exception_ptr(
-                        integration_runtime_error("Unknown error"));
-                }
+    double fv1[10], fv2[10], vec[21];
 
-                if (!static_cast<bool>(e_ptr) &&
-                    !std::all_of(
-                        d_first, d_first + std::distance(first, last),
-                        [](const double x) { return std::isfinite(x); })) {
-                    cleanup(d_first, std::distance(first, last));
-                    e_ptr = std::make_exception_ptr(
-                        integration_runtime_error("non-finite function value"));
-                }
-            };
-        guarded_transform(cbegin(x), cend(x, n), begin(x), fn_integrand, e_ptr);
-    };
-    auto ex = std::make_pair(std::forward<UnaryRealFunction_>(fn),
-                             std::exception_ptr());
-    auto &e_ptr = ex.second;
+    const auto centr = (a + b) * .5;
+    const auto hlgth = (b - a) * .5;
+    const auto dhlgth = std::abs(hlgth);
 
-    if (std::isfinite(lower) && std::isfinite(upper)) {
-        Rdqags(integrand_callback, &ex, &lower, &upper, &epsabs, &epsrel,
-               &result, &abserr, &neval, &ier, &limit, &lenw, &last,
-               iwork.data(), work.data());
-    } else {
-        // NOTE: boundary information requires a transformation for `Rdqagi`.
-        const auto translate_bounds = [](const double lower,
-                                         const double upper) {
-            int inf;
-            double bound;
-            if (std::isfinite(lower)) {
-                inf = 1;
-                bound = lower;
-            } else if (std::isfinite(upper)) {
-                inf = -1;
-                bound = upper;
-            } else {
-                inf = 2;
-                bound = 0.;
-            }
-            return std::make_pair(bound, inf);
-        };
-        auto bounds_info = translate_bounds(lower, upper);
-        auto bound = std::move(bounds_info.first);
-        auto inf = std::move(bounds_info.second);
+    // NOTE: compute the 21-point Kronrod approximation to the integral, and
+    // estimate the absolute error; all abscissae are evaluated in one call.
+    auto resg = 0.;
+    vec[0] = centr;
+    for (auto j = 1; j <= 5; ++j) {
+        const auto jtw = 2 * j;
+        const auto absc = hlgth * xgk[jtw - 1];
+        vec[2 * j - 1] = centr - absc;
+        vec[2 * j] = centr + absc;
+    }
+    for (auto j = 1; j <= 5; ++j) {
+        const auto jtwm1 = 2 * j - 1;
+        const auto absc = hlgth * xgk[jtwm1 - 1];
+        vec[2 * j + 9] = centr - absc;
+        vec[2 * j + 10] = centr + absc;
+    }
+    f(vec, 21);
 
-        Rdqagi(integrand_callback, &ex, &bound, &inf, &epsabs, &epsrel, &result,
-               &abserr, &neval, &ier, &limit, &lenw, &last, iwork.data(),
-               work.data());
-    }
-
-    // NOTE: translate error codes from `Rdqag[is]` and evaluation errors from
-    // `fn` to suitable exceptions
-    const auto throw_if_error = [](const int error_code,
-                                   std::exception_ptr e_ptr,
-                                   const return_type result) {
-        if (e_ptr) {
-            std::rethrow_exception(e_ptr);
-        }
-        if (error_code > 0) {
-            // NOTE: invalid argument errors should be caught during
-            // initialization
-            assert(error_code < 6);
-            if (error_code == 1) {
-                throw max_subdivision_error(
-                    "maximum number of subdivisions reached", result);
-
-            } else if (error_code == 2) {
-                throw roundoff_error("roundoff error was detected", result);
-            } else if (error_code == 3) {
-                throw bad_integrand_error("extremely bad integrand behaviour",
-                                          result);
-            } else if (error_code == 4) {
-                throw extrapolation_roundoff_error(
-                    "roundoff error is detected in the extrapolation table",
-                    result);
-            } else if (error_code == 5) {
-                throw divergence_error("the integral is probably divergent",
-                                       result);
-            } else {
-                throw std::logic_error(  // # nocov
-                    "invalid argument errors should be caught during "
-                    "initialization");  // # nocov
-            }
-        }
-        return;
-    };
-    throw_if_error(ier, std::move(e_ptr), out);
+    const auto fc = vec[0];
+    auto resk = wgk[10] * fc;
+    resabs = std::abs(resk);
+    for (auto j = 1; j <= 5; ++j) {
+        const auto jtw = 2 * j;
+        const auto fval1 = vec[2 * j - 1];
+        const auto fval2 = vec[2 * j];
+        fv1[jtw - 1] = fval1;
+        fv2[jtw - 1] = fval2;
+        const auto fsum = fval1 + fval2;
+        resg += wg[j - 1] * fsum;
+        resk += wgk[jtw - 1] * fsum;
+        resabs += wgk[jtw - 1] * (std::abs(fval1) + std::abs(fval2));
+    }
+    for (auto j = 1; j <= 5; ++j) {
+        const auto jtwm1 = 2 * j - 1;
+        const auto fval1 = vec[2 * j + 9];
+        const auto fval2 = vec[2 * j + 10];
+        fv1[jtwm1 - 1] = fval1;
+        fv2[jtwm1 - 1] = fval2;
+        const auto fsum = fval1 + fval2;
+        resk += wgk[jtwm1 - 1] * fsum;
+        resabs += wgk[jtwm1 - 1] * (std::abs(fval1) + std::abs(fval2));
+    }
+    const auto reskh = resk * .5;
+    resasc = wgk[10] * std::abs(fc - reskh);
+    for (auto j = 0; j < 10; ++j) {
+        resasc +=
+            wgk[j] * (std::abs(fv1[j] - reskh) + std::abs(fv2[j] - reskh));
+    }
+    result = resk * hlgth;
+    resabs *= dhlgth;
+    resasc *= dhlgth;
+    abserr = std::abs((resk - resg) * hlgth);
+    if (resasc != 0. && abserr != 0.) {
+        abserr = resasc * std::min(1., std::pow(abserr * 200. / resasc, 1.5));
+    }
+    if (resabs > uflow() / (epmach() * 50.)) {
+        abserr = std::max(epmach() * 50. * resabs, abserr);
+    }
+}
 
-    return out;
-};
+/*!
+ * \internal
+ *
+ * \brief    Computes a `(2 * ng + 1)`-point Gauss-Kronrod rule on a finite
+ *           interval as `dqk15`, `dqk31`, `dqk41`, `dqk51`, and `dqk61`,
+ *           which only differ in their constants.
+ *
+ * All abscissae are evaluated in one call.
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    ng      an `int` for the number of Gauss points, at most `30`.
+ * \param    xgk     the `ng + 1` non-negative Kronrod abscissae in descending
+ *                   order; those with odd index are the Gauss abscissae.
+ * \param    wgk     the `ng + 1` weights of the Kronrod rule.
+ * \param    wg      the `(ng + 1) / 2` weights of the Gauss rule; the last is
+ *                   the weight of the center if `ng` is odd.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    resabs  the approximated integral of `|f|`.
+ * \param    resasc  the approximated integral of `|f - I / (b - a)|`.
+ */
+template <typename Integrand_>
+inline void qk(Integrand_ &f, const double a, const double b, const int ng,
+               const double *xgk, const double *wgk, const double *wg,
+               double &result, double &abserr, double &resabs,
+               double &resasc) {
+    double vec[61], fv1[30], fv2[30];
 
-// -----------------------------------------------------------------------------
-// Implementations of integratecpp::integrate::(...)
-// -----------------------------------------------------------------------------
+    const auto centr = (a + b) * .5;
+    const auto hlgth = (b - a) * .5;
+    const auto dhlgth = std::abs(hlgth);
 
-template <typename UnaryRealFunction_>
-inline integrator::return_type integrate(UnaryRealFunction_ &&fn,
-                                         const double lower, const double upper,
-                                         const integrator::config_type config) {
-    return integrator{config}(std::forward<UnaryRealFunction_>(fn), lower,
-                              upper);
+    // NOTE: compute the Kronrod approximation to the integral, and estimate
+    // the absolute error; all abscissae are evaluated in one call.
+    vec[0] = centr;
+    for (auto j = 0; j < ng; ++j) {
+        const auto absc = hlgth * xgk[j];
+        vec[2 * j + 1] = centr - absc;
+        vec[2 * j + 2] = centr + absc;
+    }
+    f(vec, 2 * ng + 1);
+
+    const auto fc = vec[0];
+    auto resg = ng % 2 == 1 ? wg[ng / 2] * fc : 0.;
+    auto resk = wgk[ng] * fc;
+    resabs = std::abs(resk);
+    for (auto j = 1; j <= ng / 2; ++j) {
+        const auto jtw = 2 * j;
+        const auto fval1 = vec[2 * jtw - 1];
+        const auto fval2 = vec[2 * jtw];
+        fv1[jtw - 1] = fval1;
+        fv2[jtw - 1] = fval2;
+        const auto fsum = fval1 + fval2;
+        resg += wg[j - 1] * fsum;
+        resk += wgk[jtw - 1] * fsum;
+        resabs += wgk[jtw - 1] * (std::abs(fval1) + std::abs(fval2));
+    }
+    for (auto j = 1; j <= (ng + 1) / 2; ++j) {
+        const auto jtwm1 = 2 * j - 1;
+        const auto fval1 = vec[2 * jtwm1 - 1];
+        const auto fval2 = vec[2 * jtwm1];
+        fv1[jtwm1 - 1] = fval1;
+        fv2[jtwm1 - 1] = fval2;
+        const auto fsum = fval1 + fval2;
+        resk += wgk[jtwm1 - 1] * fsum;
+        resabs += wgk[jtwm1 - 1] * (std::abs(fval1) + std::abs(fval2));
+    }
+    const auto reskh = resk * .5;
+    resasc = wgk[ng] * std::abs(fc - reskh);
+    for (auto j = 0; j < ng; ++j) {
+        resasc +=
+            wgk[j] * (std::abs(fv1[j] - reskh) + std::abs(fv2[j] - reskh));
+    }
+    result = resk * hlgth;
+    resabs *= dhlgth;
+    resasc *= dhlgth;
+    abserr = std::abs((resk - resg) * hlgth);
+    if (resasc != 0. && abserr != 0.) {
+        abserr = resasc * std::min(1., std::pow(abserr * 200. / resasc, 1.5));
+    }
+    if (resabs > uflow() / (epmach() * 50.)) {
+        abserr = std::max(epmach() * 50. * resabs, abserr);
+    }
 }
 
-// -----------------------------------------------------------------------------
-// Implementations of integratecpp::integrator::return_type
-// -----------------------------------------------------------------------------
+/*!
+ * \internal
+ *
+ * \brief    Computes the 15-point Gauss-Kronrod rule on a finite interval
+ *           (`dqk15`).
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    resabs  the approximated integral of `|f|`.
+ * \param    resasc  the approximated integral of `|f - I / (b - a)|`.
+ */
+template <typename Integrand_>
+inline void qk15(Integrand_ &f, const double a, const double b, double &result,
+                 double &abserr, double &resabs, double &resasc) {
+    static constexpr double wg[4] = {
+        .129484966168869693270611432679082, .27970539148927666790146777142378,
+        .381830050505118944950369775488975, .417959183673469387755102040816327};
+    static constexpr double xgk[8] = {
+        .991455371120812639206854697526329, .949107912342758524526189684047851,
+        .864864423359769072789712788640926, .741531185599394439863864773280788,
+        .58608723546769113029414483825873, .405845151377397166906606412076961,
+        .207784955007898467600689403773245, 0.};
+    static constexpr double wgk[8] = {
+        .0229353220105292249637320080589696,
+        .0630920926299785532907006631892043, .104790010322250183839876322541518,
+        .140653259715525918745189590510238, .16900472663926790282658342659855,
+        .190350578064785409913256402421014, .204432940075298892414161999234649,
+        .209482141084727828012999174891714};
 
-inline constexpr integrator::return_type::return_type(
-    const double value, const double absolute_error, const int subdivisions,
-    const int neval) noexcept
-    : value{value},
-      absolute_error{absolute_error},
-      subdivisions{subdivisions},
-      neval{neval} {}
+    qk(f, a, b, 7, xgk, wgk, wg, result, abserr, resabs, resasc);
+}
 
-// -----------------------------------------------------------------------------
-// Implementations of integratecpp::integrator::config_type
-// -----------------------------------------------------------------------------
+/*!
+ * \internal
+ *
+ * \brief    Computes the 31-point Gauss-Kronrod rule on a finite interval
+ *           (`dqk31`).
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    resabs  the approximated integral of `|f|`.
+ * \param    resasc  the approximated integral of `|f - I / (b - a)|`.
+ */
+template <typename Integrand_>
+inline void qk31(Integrand_ &f, const double a, const double b, double &result,
+                 double &abserr, double &resabs, double &resasc) {
+    static constexpr double wg[8] = {
+        .0307532419961172683546283935772044,
+        .0703660474881081247092674164506673, .107159220467171935011869546685869,
+        .139570677926154314447804794511028, .166269205816993933553200860481209,
+        .186161000015562211026800561866423, .198431485327111576456118326443839,
+        .202578241925561272880620199967519};
+    static constexpr double xgk[16] = {
+        .998002298693397060285172840152271, .987992518020485428489565718586613,
+        .967739075679139134257347978784337, .937273392400705904307758947710209,
+        .897264532344081900882509656454496, .848206583410427216200648320774217,
+        .790418501442465932967649294817947, .724417731360170047416186054613938,
+        .650996741297416970533735895313275, .570972172608538847537226737253911,
+        .485081863640239680693655740232351, .394151347077563369897207370981045,
+        .299180007153168812166780024266389, .201194093997434522300628303394596,
+        .101142066918717499027074231447392, 0.};
+    static constexpr double wgk[16] = {
+        .00537747987292334898779205143012765,
+        .0150079473293161225383747630758073,
+        .0254608473267153201868740010196534, .03534636079137584622203794847836,
+        .0445897513247648766082272993732797,
+        .0534815246909280872653431472394303,
+        .0620095678006706402851392309608029,
+        .0698541213187282587095200770991475, .076849680757720378894432777482659,
+        .0830805028231330210382892472861038,
+        .0885644430562117706472754436937743,
+        .0931265981708253212254868727473457,
+        .0966427269836236785051799076275893,
+        .0991735987217919593323931734846031, .10076984552387559504494666261757,
+        .101330007014791549017374792767493};
 
-inline constexpr integrator::config_type::config_type(
-    const int max_subdivisions, const double relative_accuracy) noexcept
-    : config_type{max_subdivisions, relative_accuracy, relative_accuracy,
-                  4 * max_subdivisions} {}
+    qk(f, a, b, 15, xgk, wgk, wg, result, abserr, resabs, resasc);
+}
 
-inline constexpr integrator::config_type::config_type(
-    const int max_subdivisions, const double relative_accuracy,
-    const double absolute_accuracy) noexcept
-    : config_type{max_subdivisions, relative_accuracy, absolute_accuracy,
-                  4 * max_subdivisions} {}
+/*!
+ * \internal
+ *
+ * \brief    Computes the 41-point Gauss-Kronrod rule on a finite interval
+ *           (`dqk41`).
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    resabs  the approximated integral of `|f|`.
+ * \param    resasc  the approximated integral of `|f - I / (b - a)|`.
+ */
+template <typename Integrand_>
+inline void qk41(Integrand_ &f, const double a, const double b, double &result,
+                 double &abserr, double &resabs, double &resasc) {
+    static constexpr double wg[10] = {
+        .0176140071391521183118619623518528,
+        .0406014298003869413310399522749321,
+        .0626720483341090635695065351870416,
+        .0832767415767047487247581432220462, .10193011981724043503675013548035,
+        .118194531961518417312377377711382, .131688638449176626898494499748163,
+        .142096109318382051329298325067165, .149172986472603746787828737001969,
+        .152753387130725850698084331955098};
+    static constexpr double xgk[21] = {
+        .998859031588277663838315576545863, .99312859918509492478612238847132,
+        .981507877450250259193342994720217, .963971927277913791267666131197277,
+        .940822633831754753519982722212443, .912234428251325905867752441203298,
+        .878276811252281976077442995113078, .839116971822218823394529061701521,
+        .795041428837551198350638833272788, .746331906460150792614305070355642,
+        .693237656334751384805490711845932, .636053680726515025452836696226286,
+        .575140446819710315342946036586425, .510867001950827098004364050955251,
+        .44359317523872510319999221349264, .373706088715419560672548177024927,
+        .301627868114913004320555356858592, .227785851141645078080496195368575,
+        .152605465240922675505220241022678, .0765265211334973337546404093988382,
+        0.};
+    static constexpr double wgk[21] = {
+        .00307358371852053150121829324603099,
+        .00860026985564294219866178795010235,
+        .0146261692569712529837879603088684,
+        .0203883734612665235980102314327547,
+        .0258821336049511588345050670961531,
+        .0312873067770327989585431193238007, .036600169758200798030557240707211,
+        .0416688733279736862637883059368947,
+        .0464348218674976747202318809261075,
+        .0509445739237286919327076700503449,
+        .0551951053482859947448323724197773,
+        .0591114008806395723749672206485942, .062653237554781168025870122174255,
+        .0658345971336184221115635569693979,
+        .0686486729285216193456234118853678,
+        .0710544235534440683057903617232102,
+        .0730306903327866674951894176589131,
+        .0745828754004991889865814183624875,
+        .0757044976845566746595427753766166, .076377867672080736705502835038061,
+        .0766007119179996564450499015301017};
 
-inline constexpr integrator::config_type::config_type(
-    const int max_subdivisions, const double relative_accuracy,
-    const double absolute_accuracy, const int work_size) noexcept
-    : max_subdivisions{max_subdivisions},
-      relative_accuracy{relative_accuracy},
-      absolute_accuracy{absolute_accuracy},
-      work_size{work_size} {}
+    qk(f, a, b, 20, xgk, wgk, wg, result, abserr, resabs, resasc);
+}
 
-// -----------------------------------------------------------------------------
-// Implementations of integratecpp::integrator
-// -----------------------------------------------------------------------------
+/*!
+ * \internal
+ *
+ * \brief    Computes the 51-point Gauss-Kronrod rule on a finite interval
+ *           (`dqk51`).
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    resabs  the approximated integral of `|f|`.
+ * \param    resasc  the approximated integral of `|f - I / (b - a)|`.
+ */
+template <typename Integrand_>
+inline void qk51(Integrand_ &f, const double a, const double b, double &result,
+                 double &abserr, double &resabs, double &resasc) {
+    static constexpr double wg[13] = {
+        .0113937985010262879479029641132348,
+        .0263549866150321372619018152952991, .040939156701306312655623487711646,
+        .0549046959758351919259368915404733, .068038333812356917207187185656708,
+        .0801407003350010180132349596691113,
+        .0910282619829636498114972207028917, .100535949067050644202206890392686,
+        .108519624474263653116093957050117, .114858259145711648339325545869556,
+        .119455763535784772228178126512901, .122242442990310041688959518945852,
+        .12317605372671545120390287307905};
+    static constexpr double xgk[26] = {
+        .999262104992609834193457486540341, .995556969790498097908784946893902,
+        .988035794534077247637331014577406, .976663921459517511498315386479594,
+        .961614986425842512418130033660167, .942974571228974339414011169658471,
+        .920747115281701561746346084546331, .894991997878275368851042006782805,
+        .86584706529327559544899696958834, .83344262876083400142102110869357,
+        .797873797998500059410410904994307, .759259263037357630577282865204361,
+        .717766406813084388186654079773298, .673566368473468364485120633247622,
+        .626810099010317412788122681624518, .577662930241222967723689841612654,
+        .52632528433471918259962377815801, .473002731445714960522182115009192,
+        .417885382193037748851814394594572, .361172305809387837735821730127641,
+        .303089538931107830167478909980339, .243866883720988432045190362797452,
+        .183718939421048892015969888759528, .122864692610710396387359818808037,
+        .0615444830056850788865463923667966, 0.};
+    static constexpr double wgk[26] = {
+        .00198738389233031592650785188284341,
+        .00556193213535671375804023690106552,
+        .00947397338617415160720771052365532,
+        .0132362291955716748136564058469762,
+        .0168478177091282982315166675363363, .020435371145882835456568292235939,
+        .0240099456069532162200924891648811,
+        .0274753175878517378029484555178111,
+        .0307923001673874888911090202152286,
+        .0340021302743293378367487952295512,
+        .0371162714834155435603306253676199,
+        .0400838255040323820748392844670756,
+        .0428728450201700494768957924394952,
+        .0455029130499217889098705847526604,
+        .0479825371388367139063922557569148,
+        .0502776790807156719633252594334401,
+        .0523628858064074758643667121378727,
+        .0542511298885454901445433704598756,
+        .0559508112204123173082406863827473,
+        .0574371163615678328535826939395065,
+        .0586896800223942079619741758567878,
+        .0597203403241740599790992919325619,
+        .0605394553760458629453602675175654,
+        .0611285097170530483058590304162927,
+        .0614711898714253166615441319652642,
+        .0615808180678329350787598242400646};
+
+    qk(f, a, b, 25, xgk, wgk, wg, result, abserr, resabs, resasc);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Computes the 61-point Gauss-Kronrod rule on a finite interval
+ *           (`dqk61`).
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    resabs  the approximated integral of `|f|`.
+ * \param    resasc  the approximated integral of `|f - I / (b - a)|`.
+ */
+template <typename Integrand_>
+inline void qk61(Integrand_ &f, const double a, const double b, double &result,
+                 double &abserr, double &resabs, double &resasc) {
+    static constexpr double wg[15] = {
+        .00796819249616660561546588347467362,
+        .0184664683110909591423021319120473, .028784707883323369349719179611292,
+        .0387991925696270495968019364463477,
+        .0484026728305940529029381404228075,
+        .0574931562176190664817216894020561,
+        .0659742298821804951281285151159624,
+        .0737559747377052062682438500221907,
+        .0807558952294202153546949384605297,
+        .0868997872010829798023875307151257,
+        .0921225222377861287176327070876188,
+        .0963687371746442596394686263518099,
+        .0995934205867952670627802821035695, .101762389748405504596428952168554,
+        .102852652893558840341285636705415};
+    static constexpr double xgk[31] = {
+        .999484410050490637571325895705811, .996893484074649540271630050918695,
+        .991630996870404594858628366109486, .983668123279747209970032581605663,
+        .973116322501126268374693868423707, .960021864968307512216871025581798,
+        .944374444748559979415831324037439, .926200047429274325879324277080474,
+        .905573307699907798546522558925958, .882560535792052681543116462530226,
+        .857205233546061098958658510658944, .829565762382768397442898119732502,
+        .799727835821839083013668942322683, .767777432104826194917977340974503,
+        .733790062453226804726171131369528, .69785049479331579693229238802664,
+        .660061064126626961370053668149271, .620526182989242861140477556431189,
+        .57934523582636169175602493217254, .536624148142019899264169793311073,
+        .492480467861778574993693061207709, .447033769538089176780609900322854,
+        .400401254830394392535476211542661, .352704725530878113471037207089374,
+        .304073202273625077372677107199257, .254636926167889846439805129817805,
+        .204525116682309891438957671002025, .153869913608583546963794672743256,
+        .102806937966737030147096751318001, .0514718425553176958330252131667226,
+        0.};
+    static constexpr double wgk[31] = {
+        .0013890136986770076245515912267597,
+        .0038904611270998840512672018445155,
+        .00663070391593129217331982636975017,
+        .00927327965951776342844114689202436,
+        .0118230152534963417422328988532506, .01436972950704580481245143244358,
+        .0169208891890532726275722894203221,
+        .0194141411939423811734089510501285, .021828035821609192297167485738339,
+        .024191162078080601365686370725232, .0265099548823331016106017093350754,
+        .0287540487650412928439787853543342,
+        .0309072575623877624728842529430923,
+        .0329814470574837260318141910168539,
+        .0349793380280600241374996707314679, .036882364651821229223911065617136,
+        .0386789456247275929503486515322811,
+        .0403745389515359591119952797524681,
+        .0419698102151642461471475412859698,
+        .0434525397013560693168317281170733,
+        .0448148001331626631923555516167232,
+        .0460592382710069881162717355593736,
+        .0471855465692991539452614781810995,
+        .0481858617570871291407794922983046,
+        .0490554345550297788875281653672382,
+        .0497956834270742063578115693799423, .050405921402782346840893085653585,
+        .0508817958987496064922974730498047,
+        .0512215478492587721706562826049442,
+        .0514261285374590259338628792157813,
+        .0514947294294515675583404336470993};
+
+    qk(f, a, b, 30, xgk, wgk, wg, result, abserr, resabs, resasc);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Computes the 15-point Gauss-Kronrod rule on a subinterval of
+ *           `(0, 1]` for an (semi-)infinite range mapped by
+ *           `x = boun + inf * (1 - t) / t` (`dqk15i`).
+ *
+ * \param    f       the integrand.
+ * \param    boun    a `double` for the finite bound (zero if `inf == 2`).
+ * \param    inf     an `int` for the range: `1` for `(boun, +Inf)`, `-1`
+ *                   for `(-Inf, boun)`, and `2` for `(-Inf, +Inf)`.
+ * \param    a       a `double` for the lower bound of the subinterval.
+ * \param    b       a `double` for the upper bound of the subinterval.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    resabs  the approximated integral of `|f|`.
+ * \param    resasc  the approximated integral of `|f - I / (b - a)|`.
+ */
+template <typename Integrand_>
+inline void qk15i(Integrand_ &f, const double boun, const int inf,
+                  const double a, const double b, double &result,
+                  double &abserr, double &resabs, double &resasc) {
+    static constexpr double wg[8] = {0.,
+                                     .129484966168869693270611432679082,
+                                     0.,
+                                     .27970539148927666790146777142378,
+                                     0.,
+                                     .381830050505118944950369775488975,
+                                     0.,
+                                     .417959183673469387755102040816327};
+    static constexpr double xgk[8] = {
+        .991455371120812639206854697526329, .949107912342758524526189684047851,
+        .864864423359769072789712788640926, .741531185599394439863864773280788,
+        .586087235467691130294144845693013, .405845151377397166906606412076961,
+        .207784955007898467600689403773245, 0.};
+    static constexpr double wgk[8] = {
+        .02293532201052922496373200805897,  .063092092629978553290700663189204,
+        .104790010322250183839876322541518, .140653259715525918745189590510238,
+        .16900472663926790282658342659855,  .190350578064785409913256402421014,
+        .204432940075298892414161999234649, .209482141084727828012999174891714};
+
+    double fv1[7], fv2[7], vec[15], vec2[15];
+
+    const auto dinf = static_cast<double>(std::min(1, inf));
+    const auto centr = (a + b) * .5;
+    const auto hlgth = (b - a) * .5;
+
+    // NOTE: compute the 15-point Kronrod approximation to the integral, and
+    // estimate the error; all abscissae are evaluated in one call (two calls
+    // if `inf == 2`).
+    const auto tabsc0 = boun + dinf * (1. - centr) / centr;
+    vec[0] = tabsc0;
+    if (inf == 2) {
+        vec2[0] = -tabsc0;
+    }
+    for (auto j = 1; j <= 7; ++j) {
+        const auto absc = hlgth * xgk[j - 1];
+        const auto absc1 = centr - absc;
+        const auto absc2 = centr + absc;
+        const auto tabsc1 = boun + dinf * (1. - absc1) / absc1;
+        const auto tabsc2 = boun + dinf * (1. - absc2) / absc2;
+        vec[2 * j - 1] = tabsc1;
+        vec[2 * j] = tabsc2;
+        if (inf == 2) {
+            vec2[2 * j - 1] = -tabsc1;
+            vec2[2 * j] = -tabsc2;
+        }
+    }
+    f(vec, 15);
+    if (inf == 2) {
+        f(vec2, 15);
+    }
+
+    auto fval0 = vec[0];
+    if (inf == 2) {
+        fval0 += vec2[0];
+    }
+    const auto fc = fval0 / centr / centr;
+    auto resg = wg[7] * fc;
+    auto resk = wgk[7] * fc;
+    resabs = std::abs(resk);
+    for (auto j = 1; j <= 7; ++j) {
+        const auto absc = hlgth * xgk[j - 1];
+        const auto absc1 = centr - absc;
+        const auto absc2 = centr + absc;
+        auto fval1 = vec[2 * j - 1];
+        auto fval2 = vec[2 * j];
+        if (inf == 2) {
+            fval1 += vec2[2 * j - 1];
+            fval2 += vec2[2 * j];
+        }
+        fval1 = fval1 / absc1 / absc1;
+        fval2 = fval2 / absc2 / absc2;
+        fv1[j - 1] = fval1;
+        fv2[j - 1] = fval2;
+        const auto fsum = fval1 + fval2;
+        resg += wg[j - 1] * fsum;
+        resk += wgk[j - 1] * fsum;
+        resabs += wgk[j - 1] * (std::abs(fval1) + std::abs(fval2));
+    }
+    const auto reskh = resk * .5;
+    resasc = wgk[7] * std::abs(fc - reskh);
+    for (auto j = 0; j < 7; ++j) {
+        resasc +=
+            wgk[j] * (std::abs(fv1[j] - reskh) + std::abs(fv2[j] - reskh));
+    }
+    result = resk * hlgth;
+    resasc *= hlgth;
+    resabs *= hlgth;
+    abserr = std::abs((resk - resg) * hlgth);
+    if (resasc != 0. && abserr != 0.) {
+        abserr = resasc * std::min(1., std::pow(abserr * 200. / resasc, 1.5));
+    }
+    if (resabs > uflow() / (epmach() * 50.)) {
+        abserr = std::max(epmach() * 50. * resabs, abserr);
+    }
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Non-adaptive integration over a finite range by the nested
+ *           Gauss-Kronrod-Patterson 10-, 21-, 43-, and 87-point rules
+ *           (`dqng`).
+ *
+ * Each rule reuses the function values of the previous rules, i.e., the
+ * integrand is evaluated at 21, 43, or 87 abscissae in total. The abscissae
+ * added by a rule are evaluated in one call.
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    ier     the error code: `0` if the requested accuracy was
+ *                   achieved, `1` if not, and `6` for invalid input.
+ */
+template <typename Integrand_>
+inline void qng(Integrand_ &f, const double a, const double b,
+                const double epsabs, const double epsrel, double &result,
+                double &abserr, int &neval, int &ier) {
+    static constexpr double x1[5] = {
+        .973906528517171720077964012084452, .865063366688984510732096688423493,
+        .679409568299024406234327365114874, .433395394129247190799265943165784,
+        .14887433898163121088482600112972};
+    static constexpr double w10[5] = {
+        .066671344308688137593568809893332, .149451349150580593145776339657697,
+        .219086362515982043995534934228163, .269266719309996355091226921569469,
+        .295524224714752870173892994651338};
+    static constexpr double x2[5] = {
+        .995657163025808080735527280689003, .930157491355708226001207180059508,
+        .780817726586416897063717578345042, .562757134668604683339000099272694,
+        .294392862701460198131126603103866};
+    static constexpr double w21a[5] = {
+        .03255816230796472747881897245939, .07503967481091995276704314091619,
+        .109387158802297641899210590325805, .134709217311473325928054001771707,
+        .147739104901338491374841515972068};
+    static constexpr double w21b[6] = {
+        .011694638867371874278064396062192, .05475589657435199603138130024458,
+        .093125454583697605535065465083366, .123491976262065851077958109831074,
+        .142775938577060080797094273138717, .149445554002916905664936468389821};
+    static constexpr double x3[11] = {
+        .999333360901932081394099323919911, .987433402908088869795961478381209,
+        .954807934814266299257919200290473, .900148695748328293625099494069092,
+        .82519831498311415084706673258852, .732148388989304982612354848755461,
+        .622847970537725238641159120344323, .499479574071056499952214885499755,
+        .364901661346580768043989548502644, .222254919776601296498260928066212,
+        .074650617461383322043914435796506};
+    static constexpr double w43a[10] = {
+        .016296734289666564924281974617662, .037522876120869501461613795898115,
+        .054694902058255442147212685465005, .067355414609478086075553166302174,
+        .073870199632393953432140695251367, .005768556059769796184184327908655,
+        .027371890593248842081276069289151, .046560826910428830743339154433824,
+        .061744995201442564496240336030883, .071387267268693397768559114425516};
+    static constexpr double w43b[12] = {
+        .001844477640212414100389106552965, .010798689585891651740465406741293,
+        .021895363867795428102523123075149, .032597463975345689443882222526137,
+        .042163137935191811847627924327955, .050741939600184577780189020092084,
+        .058379395542619248375475369330206, .064746404951445885544689259517511,
+        .069566197912356484528633315038405, .072824441471833208150939535192842,
+        .074507751014175118273571813842889, .074722147517403005594425168280423};
+    static constexpr double x4[22] = {
+        .999902977262729234490529830591582, .99798989598667874542749632236596,
+        .992175497860687222808523352251425, .981358163572712773571916941623894,
+        .965057623858384619128284110607926, .943167613133670596816416634507426,
+        .91580641468550720959182643072005, .883221657771316501372117548744163,
+        .845710748462415666605902011504855, .803557658035230982788739474980964,
+        .75700573068549555832894279343202, .70627320978732181982409427474084,
+        .651589466501177922534422205016736, .593223374057961088875273770349144,
+        .531493605970831932285268948562671, .46676362304202284487196678165927,
+        .399424847859218804732101665817923, .329874877106188288265053371824597,
+        .258503559202161551802280975429025, .185695396568346652015917141167606,
+        .111842213179907468172398359241362, .037352123394619870814998165437704};
+    static constexpr double w87a[21] = {
+        .00814837738414917290000287844819, .018761438201562822243935059003794,
+        .027347451050052286161582829741283, .033677707311637930046581056957588,
+        .036935099820427907614589586742499, .002884872430211530501334156248695,
+        .013685946022712701888950035273128, .023280413502888311123409291030404,
+        .030872497611713358675466394126442, .035693633639418770719351355457044,
+        .000915283345202241360843392549948, .005399280219300471367738743391053,
+        .010947679601118931134327826856808, .01629873169678733526266570322328,
+        .02108156888920383511243306018819, .02537096976925382724346799983171,
+        .02918969775647575250144615408492, .032373202467202789685788194889596,
+        .034783098950365142750781997949596, .036412220731351787562801163687577,
+        .037253875503047708539592001191226};
+    static constexpr double w87b[23] = {
+        .000274145563762072350016527092881, .001807124155057942948341311753254,
+        .00409686928275916486445807068348, .006758290051847378699816577897424,
+        .009549957672201646536053581325377, .01232944765224485369462663996378,
+        .015010447346388952376697286041943, .0175489679862431910996653529259,
+        .019938037786440888202278192730714, .022194935961012286796332102959499,
+        .024339147126000805470360647041454, .026374505414839207241503786552615,
+        .02828691078877120065996800298796, .030052581128092695322521110347341,
+        .031646751371439929404586051078883, .033050413419978503290785944862689,
+        .034255099704226061787082821046821, .035262412660156681033782717998428,
+        .036076989622888701185500318003895, .036698604498456094498018047441094,
+        .037120549269832576114119958413599, .037334228751935040321235449094698,
+        .037361073762679023410321241766599};
+    double vec[44], savfun[21], fv1[5], fv2[5], fv3[5], fv4[5];
+
+    // NOTE: test on validity of parameters
+    result = 0.;
+    abserr = 0.;
+    neval = 0;
+    ier = 6;
+    if (epsabs <= 0. && epsrel < std::max(epmach() * 50., 0.5e-28)) {
+        return;
+    }
+    const auto hlgth = (b - a) * .5;
+    const auto dhlgth = std::abs(hlgth);
+    const auto centr = (b + a) * .5;
+    ier = 1;
+
+    // NOTE: compute the integral using the 10- and 21-point formula.
+    vec[0] = centr;
+    for (auto k = 0; k < 5; ++k) {
+        const auto absc = hlgth * x1[k];
+        vec[2 * k + 1] = centr + absc;
+        vec[2 * k + 2] = centr - absc;
+    }
+    for (auto k = 0; k < 5; ++k) {
+        const auto absc = hlgth * x2[k];
+        vec[2 * k + 11] = centr + absc;
+        vec[2 * k + 12] = centr - absc;
+    }
+    f(vec, 21);
+    neval = 21;
+
+    const auto fcentr = vec[0];
+    auto res10 = 0.;
+    auto res21 = w21b[5] * fcentr;
+    auto resabs = w21b[5] * std::abs(fcentr);
+    for (auto k = 0; k < 5; ++k) {
+        const auto fval1 = vec[2 * k + 1];
+        const auto fval2 = vec[2 * k + 2];
+        const auto fval = fval1 + fval2;
+        res10 += w10[k] * fval;
+        res21 += w21a[k] * fval;
+        resabs += w21a[k] * (std::abs(fval1) + std::abs(fval2));
+        savfun[k] = fval;
+        fv1[k] = fval1;
+        fv2[k] = fval2;
+    }
+    for (auto k = 0; k < 5; ++k) {
+        const auto fval1 = vec[2 * k + 11];
+        const auto fval2 = vec[2 * k + 12];
+        const auto fval = fval1 + fval2;
+        res21 += w21b[k] * fval;
+        resabs += w21b[k] * (std::abs(fval1) + std::abs(fval2));
+        savfun[k + 5] = fval;
+        fv3[k] = fval1;
+        fv4[k] = fval2;
+    }
+
+    // NOTE: test for convergence.
+    result = res21 * hlgth;
+    resabs *= dhlgth;
+    const auto reskh = res21 * .5;
+    auto resasc = w21b[5] * std::abs(fcentr - reskh);
+    for (auto k = 0; k < 5; ++k) {
+        resasc +=
+            w21a[k] * (std::abs(fv1[k] - reskh) + std::abs(fv2[k] - reskh)) +
+            w21b[k] * (std::abs(fv3[k] - reskh) + std::abs(fv4[k] - reskh));
+    }
+    abserr = std::abs((res21 - res10) * hlgth);
+    resasc *= dhlgth;
+
+    auto res43 = 0.;
+    for (auto l = 1; l <= 3; ++l) {
+        if (l == 2) {
+            // NOTE: compute the integral using the 43-point formula.
+            res43 = w43b[11] * fcentr;
+            for (auto k = 0; k < 10; ++k) {
+                res43 += savfun[k] * w43a[k];
+            }
+            for (auto k = 0; k < 11; ++k) {
+                const auto absc = hlgth * x3[k];
+                vec[2 * k] = absc + centr;
+                vec[2 * k + 1] = centr - absc;
+            }
+            f(vec, 22);
+            neval = 43;
+            for (auto k = 0; k < 11; ++k) {
+                const auto fval = vec[2 * k] + vec[2 * k + 1];
+                res43 += fval * w43b[k];
+                savfun[k + 10] = fval;
+            }
+
+            // NOTE: test for convergence.
+            result = res43 * hlgth;
+            abserr = std::abs((res43 - res21) * hlgth);
+        } else if (l == 3) {
+            // NOTE: compute the integral using the 87-point formula.
+            auto res87 = w87b[22] * fcentr;
+            for (auto k = 0; k < 21; ++k) {
+                res87 += savfun[k] * w87a[k];
+            }
+            for (auto k = 0; k < 22; ++k) {
+                const auto absc = hlgth * x4[k];
+                vec[2 * k] = absc + centr;
+                vec[2 * k + 1] = centr - absc;
+            }
+            f(vec, 44);
+            neval = 87;
+            for (auto k = 0; k < 22; ++k) {
+                res87 += w87b[k] * (vec[2 * k] + vec[2 * k + 1]);
+            }
+            result = res87 * hlgth;
+            abserr = std::abs((res87 - res43) * hlgth);
+        }
+        if (resasc != 0. && abserr != 0.) {
+            abserr =
+                resasc * std::min(1., std::pow(abserr * 200. / resasc, 1.5));
+        }
+        if (resabs > uflow() / (epmach() * 50.)) {
+            abserr = std::max(epmach() * 50. * resabs, abserr);
+        }
+        if (abserr <= std::max(epsabs, epsrel * std::abs(result))) {
+            ier = 0;
+            return;
+        }
+    }
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Maintains the descending ordering in the list of error estimates
+ *           and selects the subinterval with the `nrmax`-th largest error
+ *           estimate (`dqpsrt`).
+ *
+ * \param    limit   an `int` for the maximum number of subintervals.
+ * \param    last    an `int` for the number of subintervals.
+ * \param    maxerr  the (one-based) index of the subinterval with the
+ *                   `nrmax`-th largest error estimate.
+ * \param    ermax   the `nrmax`-th largest error estimate.
+ * \param    elist   the error estimates.
+ * \param    iord    the (one-based) indices of the subintervals such that
+ *                   `elist[iord[0] - 1], ..., elist[iord[k - 1] - 1]` is
+ *                   decreasing with `k = last` if `last <= limit / 2 + 2`
+ *                   and `k = limit + 1 - last` otherwise.
+ * \param    nrmax   the position of `maxerr` in `iord`.
+ */
+inline void qpsrt(const int limit, const int last, int &maxerr, double &ermax,
+                  const double *elist, int *iord, int &nrmax) {
+    if (last <= 2) {
+        iord[0] = 1;
+        iord[1] = 2;
+    } else {
+        // NOTE: this part is only executed if, due to a difficult integrand,
+        // subdivision increased the error estimate. in the normal case the
+        // insert procedure should start after the nrmax-th largest error
+        // estimate.
+        const auto errmax = elist[maxerr - 1];
+        if (nrmax != 1) {
+            const auto ido = nrmax - 1;
+            for (auto i = 1; i <= ido; ++i) {
+                const auto isucc = iord[nrmax - 2];
+                if (errmax <= elist[isucc - 1]) {
+                    break;
+                }
+                iord[nrmax - 1] = isucc;
+                --nrmax;
+            }
+        }
+
+        // NOTE: compute the number of elements in the list to be maintained
+        // in descending order. this number depends on the number of
+        // subdivisions still allowed.
+        const auto jupbn = last > limit / 2 + 2 ? limit + 3 - last : last;
+        const auto errmin = elist[last - 1];
+
+        // NOTE: insert errmax by traversing the list top-down.
+        const auto jbnd = jupbn - 1;
+        const auto ibeg = nrmax + 1;
+        auto i = ibeg;
+        for (; i <= jbnd; ++i) {
+            const auto isucc = iord[i - 1];
+            if (errmax >= elist[isucc - 1]) {
+                break;
+            }
+            iord[i - 2] = isucc;
+        }
+        if (i > jbnd) {
+            iord[jbnd - 1] = maxerr;
+            iord[jupbn - 1] = last;
+        } else {
+            // NOTE: insert errmin by traversing the list bottom-up.
+            iord[i - 2] = maxerr;
+            auto k = jbnd;
+            auto j = i;
+            for (; j <= jbnd; ++j) {
+                const auto isucc = iord[k - 1];
+                if (errmin < elist[isucc - 1]) {
+                    break;
+                }
+                iord[k] = isucc;
+                --k;
+            }
+            if (j > jbnd) {
+                iord[i - 1] = last;
+            } else {
+                iord[k] = last;
+            }
+        }
+    }
+
+    // NOTE: set maxerr and ermax.
+    maxerr = iord[nrmax - 1];
+    ermax = elist[maxerr - 1];
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Determines the limit of a given sequence of approximations by
+ *           means of the epsilon algorithm of P. Wynn (`dqelg`).
+ *
+ * \param    n       the index of the new element in the first column of the
+ *                   epsilon table; adjusted if the table is reduced.
+ * \param    epstab  the epsilon table of size `52`.
+ * \param    result  the resulting approximation of the integral.
+ * \param    abserr  the estimate of the absolute error.
+ * \param    res3la  the last three results of size `3`.
+ * \param    nres    the number of calls to this routine.
+ */
+inline void qelg(int &n, double *epstab, double &result, double &abserr,
+                 double *res3la, int &nres) {
+    constexpr auto limexp = 50;
+
+    ++nres;
+    abserr = oflow();
+    result = epstab[n - 1];
+    if (n >= 3) {
+        epstab[n + 1] = epstab[n - 1];
+        const auto newelm = (n - 1) / 2;
+        epstab[n - 1] = oflow();
+        const auto num = n;
+        auto k1 = n;
+        auto converged = false;
+        for (auto i = 1; i <= newelm; ++i) {
+            const auto k2 = k1 - 1;
+            const auto k3 = k1 - 2;
+            auto res = epstab[k1 + 1];
+            const auto e0 = epstab[k3 - 1];
+            const auto e1 = epstab[k2 - 1];
+            const auto e2 = res;
+            const auto e1abs = std::abs(e1);
+            const auto delta2 = e2 - e1;
+            const auto err2 = std::abs(delta2);
+            const auto tol2 = std::max(std::abs(e2), e1abs) * epmach();
+            const auto delta3 = e1 - e0;
+            const auto err3 = std::abs(delta3);
+            const auto tol3 = std::max(e1abs, std::abs(e0)) * epmach();
+            if (err2 <= tol2 && err3 <= tol3) {
+                // NOTE: if e0, e1 and e2 are equal to within machine accuracy,
+                // convergence is assumed.
+                result = res;
+                abserr = err2 + err3;
+                converged = true;
+                break;
+            }
+
+            const auto e3 = epstab[k1 - 1];
+            epstab[k1 - 1] = e1;
+            const auto delta1 = e1 - e3;
+            const auto err1 = std::abs(delta1);
+            const auto tol1 = std::max(e1abs, std::abs(e3)) * epmach();
+
+            // NOTE: if two elements are very close to each other, omit a part
+            // of the table by adjusting the value of n.
+            if (err1 <= tol1 || err2 <= tol2 || err3 <= tol3) {
+                n = i + i - 1;
+                break;
+            }
+            const auto ss = 1. / delta1 + 1. / delta2 - 1. / delta3;
+            const auto epsinf = std::abs(ss * e1);
+
+            // NOTE: test to detect irregular behaviour in the table, and
+            // eventually omit a part of the table adjusting the value of n.
+            if (epsinf <= 1e-4) {
+                n = i + i - 1;
+                break;
+            }
+
+            // NOTE: compute a new element and eventually adjust the value of
+            // result.
+            res = e1 + 1. / ss;
+            epstab[k1 - 1] = res;
+            k1 -= 2;
+            const auto error = err2 + std::abs(res - e2) + err3;
+            if (error <= abserr) {
+                abserr = error;
+                result = res;
+            }
+        }
+
+        if (!converged) {
+            // NOTE: shift the table.
+            if (n == limexp) {
+                n = (limexp / 2) * 2 - 1;
+            }
+            auto ib = (num / 2) * 2 == num ? 2 : 1;
+            const auto ie = newelm + 1;
+            for (auto i = 1; i <= ie; ++i) {
+                const auto ib2 = ib + 2;
+                epstab[ib - 1] = epstab[ib2 - 1];
+                ib = ib2;
+            }
+            if (num != n) {
+                auto indx = num - n + 1;
+                for (auto i = 1; i <= n; ++i) {
+                    epstab[i - 1] = epstab[indx - 1];
+                    ++indx;
+                }
+            }
+            if (nres < 4) {
+                res3la[nres - 1] = result;
+                abserr = oflow();
+            } else {
+                // NOTE: compute error estimate
+                abserr = std::abs(result - res3la[2]) +
+                         std::abs(result - res3la[1]) +
+                         std::abs(result - res3la[0]);
+                res3la[0] = res3la[1];
+                res3la[1] = res3la[2];
+                res3la[2] = result;
+            }
+        }
+    }
+    abserr = std::max(abserr, epmach() * 5. * std::abs(result));
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Wraps `integratecpp::quadpack::qk21` as a rule for
+ *           `integratecpp::quadpack::qagse`.
+ */
+template <typename Integrand_>
+struct qk21_rule {
+    Integrand_ &f;
+
+    //! \internal
+    //! \brief The number of function evaluations per rule application.
+    int neval() const noexcept { return 21; }
+
+    void operator()(const double a, const double b, double &result,
+                    double &abserr, double &resabs, double &resasc) const {
+        qk21(f, a, b, result, abserr, resabs, resasc);
+    }
+};
+
+/*!
+ * \internal
+ *
+ * \brief    Wraps `integratecpp::quadpack::qk15i` as a rule for
+ *           `integratecpp::quadpack::qagse`.
+ */
+template <typename Integrand_>
+struct qk15i_rule {
+    Integrand_ &f;
+    double boun;
+    int inf;
+
+    //! \internal
+    //! \brief The number of function evaluations per rule application.
+    int neval() const noexcept { return inf == 2 ? 30 : 15; }
+
+    void operator()(const double a, const double b, double &result,
+                    double &abserr, double &resabs, double &resasc) const {
+        qk15i(f, boun, inf, a, b, result, abserr, resabs, resasc);
+    }
+};
+
+/*!
+ * \internal
+ *
+ * \brief    Wraps the Gauss-Kronrod rule with `points` points, i.e., one of
+ *           `integratecpp::quadpack::qk15`, `qk21`, `qk31`, `qk41`, `qk51`,
+ *           and `qk61`, as a rule for `integratecpp::quadpack::qage`.
+ */
+template <typename Integrand_>
+struct gauss_kronrod_rule {
+    Integrand_ &f;
+    int points;
+
+    //! \internal
+    //! \brief The number of function evaluations per rule application.
+    int neval() const noexcept { return points; }
+
+    void operator()(const double a, const double b, double &result,
+                    double &abserr, double &resabs, double &resasc) const {
+        switch (points) {
+            case 15:
+                qk15(f, a, b, result, abserr, resabs, resasc);
+                break;
+            case 31:
+                qk31(f, a, b, result, abserr, resabs, resasc);
+                break;
+            case 41:
+                qk41(f, a, b, result, abserr, resabs, resasc);
+                break;
+            case 51:
+                qk51(f, a, b, result, abserr, resabs, resasc);
+                break;
+            case 61:
+                qk61(f, a, b, result, abserr, resabs, resasc);
+                break;
+            default:
+                qk21(f, a, b, result, abserr, resabs, resasc);
+                break;
+        }
+    }
+};
+
+/*!
+ * \internal
+ *
+ * \brief    Selects the subinterval to be bisected next for
+ *           `integratecpp::quadpack::qagse` from the list of error estimates
+ *           in descending order, maintained by `integratecpp::quadpack::qpsrt`
+ *           with linear insertion.
+ *
+ * Intervals skipped during extrapolation as they are too small are the first
+ * `nrmax - 1` entries of `iord`.
+ */
+class ordered_list_selection {
+   public:
+    ordered_list_selection(const int limit, const double *elist,
+                           int *iord) noexcept
+        : limit_{limit}, elist_{elist}, iord_{iord} {}
+
+    //! \internal
+    //! \brief Initializes the list with the first interval as selected.
+    void init() noexcept {
+        iord_[0] = 1;
+        nrmax_ = 1;
+    }
+
+    //! \internal
+    //! \brief Inserts the bisected interval `maxerr` and the new interval
+    //!        `last`, and selects the next interval.
+    void update(const int last, int &maxerr, double &errmax) noexcept {
+        qpsrt(limit_, last, maxerr, errmax, elist_, iord_, nrmax_);
+    }
+
+    //! \internal
+    //! \brief Skips the selected interval until the next `reset`.
+    void skip() noexcept { ++nrmax_; }
+
+    //! \internal
+    //! \brief Selects the interval with the largest error estimate among the
+    //!        intervals not skipped and skips it if it is not larger than
+    //!        `small`, until such an interval is found.
+    bool select_large(const int last, const double small, const double *alist,
+                      const double *blist, int &maxerr,
+                      double &errmax) noexcept {
+        const auto jupbnd = last > limit_ / 2 + 2 ? limit_ + 3 - last : last;
+        for (auto k = nrmax_; k <= jupbnd; ++k) {
+            maxerr = iord_[nrmax_ - 1];
+            errmax = elist_[maxerr - 1];
+            if (std::abs(blist[maxerr - 1] - alist[maxerr - 1]) > small) {
+                return true;
+            }
+            ++nrmax_;
+        }
+        return false;
+    }
+
+    //! \internal
+    //! \brief Selects the interval with the largest error estimate.
+    void reset(int &maxerr, double &errmax) noexcept {
+        maxerr = iord_[0];
+        errmax = elist_[maxerr - 1];
+        nrmax_ = 1;
+    }
+
+   private:
+    int limit_;
+    const double *elist_;
+    int *iord_;
+    int nrmax_{1};
+};
+
+/*!
+ * \internal
+ *
+ * \brief    Selects the subinterval to be bisected next for
+ *           `integratecpp::quadpack::qagse` from a binary max-heap of error
+ *           estimates.
+ *
+ * Insertion and selection are `O(log(last))` instead of `O(last)` with
+ * `integratecpp::quadpack::ordered_list_selection` and select the same
+ * intervals, up to ties of error estimates. The selected interval is not part
+ * of the heap. `iord` holds the heap at its front and the intervals skipped
+ * during extrapolation, which have larger error estimates than all intervals
+ * in the heap, at its back.
+ */
+class heap_selection {
+   public:
+    heap_selection(const int limit, const double *elist, int *iord) noexcept
+        : limit_{limit}, elist_{elist}, iord_{iord} {}
+
+    //! \internal
+    //! \brief Initializes the heap with the first interval as selected.
+    void init() noexcept {
+        nheap_ = 0;
+        nskipped_ = 0;
+        selected_ = 1;
+    }
+
+    //! \internal
+    //! \brief Inserts the bisected interval `maxerr` and the new interval
+    //!        `last`, and selects the next interval.
+    void update(const int last, int &maxerr, double &errmax) noexcept {
+        push(maxerr);
+        push(last);
+        // NOTE: skipped intervals with smaller error estimates than the
+        // bisected interval are no longer skipped (as in `dqpsrt`).
+        while (nskipped_ > 0 &&
+               elist_[maxerr - 1] > elist_[iord_[limit_ - nskipped_] - 1]) {
+            push(iord_[limit_ - nskipped_]);
+            --nskipped_;
+        }
+        selected_ = pop();
+        maxerr = selected_;
+        errmax = elist_[maxerr - 1];
+    }
+
+    //! \internal
+    //! \brief Skips the selected interval until the next `reset`.
+    void skip() noexcept {
+        ++nskipped_;
+        iord_[limit_ - nskipped_] = selected_;
+        selected_ = 0;
+    }
+
+    //! \internal
+    //! \brief Selects the interval with the largest error estimate among the
+    //!        intervals not skipped and skips it if it is not larger than
+    //!        `small`, until such an interval is found.
+    bool select_large(const int /* last */, const double small,
+                      const double *alist, const double *blist, int &maxerr,
+                      double &errmax) noexcept {
+        while (selected_ != 0 || nheap_ > 0) {
+            if (selected_ == 0) {
+                selected_ = pop();
+            }
+            maxerr = selected_;
+            errmax = elist_[maxerr - 1];
+            if (std::abs(blist[maxerr - 1] - alist[maxerr - 1]) > small) {
+                return true;
+            }
+            skip();
+        }
+        return false;
+    }
+
+    //! \internal
+    //! \brief Selects the interval with the largest error estimate.
+    void reset(int &maxerr, double &errmax) noexcept {
+        // NOTE: rebuild the heap in linear time as possibly all intervals were
+        // skipped.
+        if (selected_ != 0) {
+            iord_[nheap_++] = selected_;
+        }
+        for (; nskipped_ > 0; --nskipped_) {
+            iord_[nheap_++] = iord_[limit_ - nskipped_];
+        }
+        std::make_heap(iord_, iord_ + nheap_, less{elist_});
+        selected_ = pop();
+        maxerr = selected_;
+        errmax = elist_[maxerr - 1];
+    }
+
+   private:
+    int limit_;
+    const double *elist_;
+    int *iord_;
+    int nheap_{0};
+    int nskipped_{0};
+    int selected_{1};
+
+    //! \internal
+    //! \brief Compares (one-based) indices by their error estimates.
+    struct less {
+        const double *elist;
+        bool operator()(const int i, const int j) const noexcept {
+            return elist[i - 1] < elist[j - 1];
+        }
+    };
+
+    void push(const int i) noexcept {
+        iord_[nheap_++] = i;
+        std::push_heap(iord_, iord_ + nheap_, less{elist_});
+    }
+
+    int pop() noexcept {
+        std::pop_heap(iord_, iord_ + nheap_, less{elist_});
+        return iord_[--nheap_];
+    }
+};
+
+/*!
+ * \internal
+ *
+ * \brief    Adaptive integration with extrapolation by the epsilon algorithm
+ *           (`dqagse`), which is shared by `dqags` for finite ranges and
+ *           `dqagi` for (semi-)infinite ranges mapped onto `(0, 1]` (as
+ *           `dqagie` only differs from `dqagse` in the applied rule).
+ *
+ * \tparam   Rule_       a rule type like
+ *                       `integratecpp::quadpack::qk21_rule`.
+ * \tparam   Selection_  a selection type like
+ *                       `integratecpp::quadpack::ordered_list_selection`.
+ *
+ * \param    rule    the rule applied to subintervals.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    limit   an `int` for the maximum number of subintervals.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    ier     the error code as in `Rdqags`.
+ * \param    alist   the lower bounds of the subintervals.
+ * \param    blist   the upper bounds of the subintervals.
+ * \param    rlist   the integral approximations on the subintervals.
+ * \param    elist   the error estimates on the subintervals.
+ * \param    iord    the (one-based) indices of the subintervals ordered by
+ *                   their error estimates; see `Selection_`.
+ * \param    last    the number of subintervals.
+ */
+template <typename Rule_, typename Selection_ = ordered_list_selection>
+inline void qagse(const Rule_ &rule, const double a, const double b,
+                  const double epsabs, const double epsrel, const int limit,
+                  double &result, double &abserr, int &neval, int &ier,
+                  double *alist, double *blist, double *rlist, double *elist,
+                  int *iord, int &last) {
+    // NOTE: test on validity of parameters
+    ier = 0;
+    neval = 0;
+    last = 0;
+    result = 0.;
+    abserr = 0.;
+    alist[0] = a;
+    blist[0] = b;
+    rlist[0] = 0.;
+    elist[0] = 0.;
+    if (epsabs <= 0. && epsrel < std::max(epmach() * 50., 0.5e-28)) {
+        ier = 6;
+        return;
+    }
+
+    // NOTE: first approximation to the integral
+    auto ierro = 0;
+    auto defabs = 0.;
+    auto resabs = 0.;
+    rule(a, b, result, abserr, defabs, resabs);
+
+    // NOTE: test on accuracy.
+    const auto dres = std::abs(result);
+    auto errbnd = std::max(epsabs, epsrel * dres);
+    last = 1;
+    rlist[0] = result;
+    elist[0] = abserr;
+    auto selection = Selection_{limit, elist, iord};
+    selection.init();
+    if (abserr <= epmach() * 100. * defabs && abserr > errbnd) {
+        ier = 2;
+    }
+    if (limit == 1) {
+        ier = 1;
+    }
+    if (ier != 0 || (abserr <= errbnd && abserr != resabs) || abserr == 0.) {
+        neval = rule.neval() * (2 * last - 1);
+        return;
+    }
+
+    // NOTE: initialization
+    double rlist2[52], res3la[3];
+    rlist2[0] = result;
+    auto errmax = abserr;
+    auto maxerr = 1;
+    auto area = result;
+    auto errsum = abserr;
+    abserr = oflow();
+    auto nres = 0;
+    auto numrl2 = 2;
+    auto ktmin = 0;
+    auto extrap = false;
+    auto noext = false;
+    auto iroff1 = 0;
+    auto iroff2 = 0;
+    auto iroff3 = 0;
+    const auto ksgn = dres >= (1. - epmach() * 50.) * defabs ? 1 : -1;
+    auto small = 0.;
+    auto erlarg = 0.;
+    auto ertest = 0.;
+    auto correc = 0.;
+
+    // NOTE: `sum_up` marks exits which compute the result as sum over all
+    // subintervals.
+    auto sum_up = false;
+
+    // NOTE: main loop
+    for (last = 2; last <= limit; ++last) {
+        // NOTE: bisect the subinterval with the nrmax-th largest error
+        // estimate.
+        const auto a1 = alist[maxerr - 1];
+        const auto b1 = (alist[maxerr - 1] + blist[maxerr - 1]) * .5;
+        const auto a2 = b1;
+        const auto b2 = blist[maxerr - 1];
+        const auto erlast = errmax;
+        auto area1 = 0.;
+        auto error1 = 0.;
+        auto defab1 = 0.;
+        auto area2 = 0.;
+        auto error2 = 0.;
+        auto defab2 = 0.;
+        rule(a1, b1, area1, error1, resabs, defab1);
+        rule(a2, b2, area2, error2, resabs, defab2);
+
+        // NOTE: improve previous approximations to integral and error and
+        // test for accuracy.
+        const auto area12 = area1 + area2;
+        const auto erro12 = error1 + error2;
+        errsum = errsum + erro12 - errmax;
+        area = area + area12 - rlist[maxerr - 1];
+        if (!(defab1 == error1 || defab2 == error2)) {
+            if (!(std::abs(rlist[maxerr - 1] - area12) >
+                      std::abs(area12) * 1e-5 ||
+                  erro12 < errmax * .99)) {
+                if (extrap) {
+                    ++iroff2;
+                } else {
+                    ++iroff1;
+                }
+            }
+            if (last > 10 && erro12 > errmax) {
+                ++iroff3;
+            }
+        }
+        rlist[maxerr - 1] = area1;
+        rlist[last - 1] = area2;
+        errbnd = std::max(epsabs, epsrel * std::abs(area));
+
+        // NOTE: test for roundoff error and eventually set error flag.
+        if (iroff1 + iroff2 >= 10 || iroff3 >= 20) {
+            ier = 2;
+        }
+        if (iroff2 >= 5) {
+            ierro = 3;
+        }
+
+        // NOTE: set error flag in the case that the number of subintervals
+        // equals limit.
+        if (last == limit) {
+            ier = 1;
+        }
+
+        // NOTE: set error flag in the case of bad integrand behaviour at a
+        // point of the integration range.
+        if (std::max(std::abs(a1), std::abs(b2)) <=
+            (epmach() * 100. + 1.) * (std::abs(a2) + uflow() * 1e3)) {
+            ier = 4;
+        }
+
+        // NOTE: append the newly-created intervals to the list.
+        if (error2 > error1) {
+            alist[maxerr - 1] = a2;
+            alist[last - 1] = a1;
+            blist[last - 1] = b1;
+            rlist[maxerr - 1] = area2;
+            rlist[last - 1] = area1;
+            elist[maxerr - 1] = error2;
+            elist[last - 1] = error1;
+        } else {
+            alist[last - 1] = a2;
+            blist[maxerr - 1] = b1;
+            blist[last - 1] = b2;
+            elist[maxerr - 1] = error1;
+            elist[last - 1] = error2;
+        }
+
+        // NOTE: maintain the descending ordering in the list of error
+        // estimates and select the subinterval with nrmax-th largest error
+        // estimate (to be bisected next).
+        selection.update(last, maxerr, errmax);
+        if (errsum <= errbnd) {
+            sum_up = true;
+            break;
+        }
+        if (ier != 0) {
+            break;
+        }
+        if (last == 2) {
+            small = std::abs(b - a) * .375;
+            erlarg = errsum;
+            ertest = errbnd;
+            rlist2[1] = area;
+            continue;
+        }
+        if (noext) {
+            continue;
+        }
+        erlarg -= erlast;
+        if (std::abs(b1 - a1) > small) {
+            erlarg += erro12;
+        }
+        if (!extrap) {
+            // NOTE: test whether the interval to be bisected next is the
+            // smallest interval.
+            if (std::abs(blist[maxerr - 1] - alist[maxerr - 1]) > small) {
+                continue;
+            }
+            extrap = true;
+            selection.skip();
+        }
+
+        if (ierro != 3 && erlarg > ertest) {
+            // NOTE: the smallest interval has the largest error. before
+            // bisecting decrease the sum of the errors over the larger
+            // intervals (erlarg) and perform extrapolation.
+            if (selection.select_large(last, small, alist, blist, maxerr,
+                                       errmax)) {
+                continue;
+            }
+        }
+
+        // NOTE: perform extrapolation.
+        ++numrl2;
+        rlist2[numrl2 - 1] = area;
+        auto reseps = 0.;
+        auto abseps = 0.;
+        qelg(numrl2, rlist2, reseps, abseps, res3la, nres);
+        ++ktmin;
+        if (ktmin > 5 && abserr < errsum * .001) {
+            ier = 5;
+        }
+        if (abseps < abserr) {
+            ktmin = 0;
+            abserr = abseps;
+            result = reseps;
+            correc = erlarg;
+            ertest = std::max(epsabs, epsrel * std::abs(reseps));
+            if (abserr <= ertest) {
+                break;
+            }
+        }
+
+        // NOTE: prepare bisection of the smallest interval.
+        if (numrl2 == 1) {
+            noext = true;
+        }
+        if (ier == 5) {
+            break;
+        }
+        selection.reset(maxerr, errmax);
+        extrap = false;
+        small *= .5;
+        erlarg = errsum;
+    }
+
+    // NOTE: set final result and error estimate.
+    if (!sum_up) {
+        auto test_divergence = true;
+        if (abserr == oflow()) {
+            sum_up = true;
+        } else if (ier + ierro != 0) {
+            if (ierro == 3) {
+                abserr += correc;
+            }
+            if (ier == 0) {
+                ier = 3;
+            }
+            if (result != 0. && area != 0.) {
+                if (abserr / std::abs(result) > errsum / std::abs(area)) {
+                    sum_up = true;
+                }
+            } else if (abserr > errsum) {
+                sum_up = true;
+            } else if (area == 0.) {
+                test_divergence = false;
+            }
+        }
+
+        // NOTE: test on divergence.
+        if (!sum_up && test_divergence &&
+            !(ksgn == -1 &&
+              std::max(std::abs(result), std::abs(area)) <= defabs * .01)) {
+            if (.01 > result / area || result / area > 100. ||
+                errsum > std::abs(area)) {
+                ier = 6;
+            }
+        }
+    }
+
+    // NOTE: compute global integral sum.
+    if (sum_up) {
+        result = 0.;
+        for (auto k = 0; k < last; ++k) {
+            result += rlist[k];
+        }
+        abserr = errsum;
+    }
+
+    if (ier > 2) {
+        --ier;
+    }
+    neval = rule.neval() * (2 * last - 1);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Computes a definite integral over a finite range (`Rdqags`).
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    ier     the error code as in `Rdqags`.
+ * \param    limit   an `int` for the maximum number of subintervals.
+ * \param    lenw    an `int` for the size of the working array.
+ * \param    last    the number of subintervals.
+ * \param    iwork   an index array of size `limit`.
+ * \param    work    a working array of size `lenw`.
+ *
+ * \tparam   Selection_  a selection type for
+ *                       `integratecpp::quadpack::qagse`.
+ */
+template <typename Integrand_, typename Selection_ = ordered_list_selection>
+inline void qags(Integrand_ &f, const double a, const double b,
+                 const double epsabs, const double epsrel, double &result,
+                 double &abserr, int &neval, int &ier, const int limit,
+                 const int lenw, int &last, int *iwork, double *work) {
+    ier = 6;
+    neval = 0;
+    last = 0;
+    result = 0.;
+    abserr = 0.;
+    if (limit < 1 || lenw < limit * 4) {
+        return;
+    }
+    const auto rule = qk21_rule<Integrand_>{f};
+    qagse<decltype(rule), Selection_>(
+        rule, a, b, epsabs, epsrel, limit, result, abserr, neval, ier,
+        &work[0], &work[limit], &work[2 * limit], &work[3 * limit], iwork,
+        last);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Computes a definite integral over a (semi-)infinite range
+ *           (`Rdqagi`).
+ *
+ * \param    f       the integrand.
+ * \param    bound   a `double` for the finite bound (ignored if `inf == 2`).
+ * \param    inf     an `int` for the range: `1` for `(bound, +Inf)`, `-1`
+ *                   for `(-Inf, bound)`, and `2` for `(-Inf, +Inf)`.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    ier     the error code as in `Rdqagi`.
+ * \param    limit   an `int` for the maximum number of subintervals.
+ * \param    lenw    an `int` for the size of the working array.
+ * \param    last    the number of subintervals.
+ * \param    iwork   an index array of size `limit`.
+ * \param    work    a working array of size `lenw`.
+ *
+ * \tparam   Selection_  a selection type for
+ *                       `integratecpp::quadpack::qagse`.
+ */
+template <typename Integrand_, typename Selection_ = ordered_list_selection>
+inline void qagi(Integrand_ &f, const double bound, const int inf,
+                 const double epsabs, const double epsrel, double &result,
+                 double &abserr, int &neval, int &ier, const int limit,
+                 const int lenw, int &last, int *iwork, double *work) {
+    ier = 6;
+    neval = 0;
+    last = 0;
+    result = 0.;
+    abserr = 0.;
+    if (limit < 1 || lenw < limit * 4) {
+        return;
+    }
+    // NOTE: if inf = 2 the integral is computed as i = i1 + i2, where i1 is
+    // the integral of f over (-infinity, 0) and i2 is the integral of f over
+    // (0, +infinity).
+    const auto rule =
+        qk15i_rule<Integrand_>{f, inf == 2 ? 0. : bound, inf};
+    qagse<decltype(rule), Selection_>(
+        rule, 0., 1., epsabs, epsrel, limit, result, abserr, neval, ier,
+        &work[0], &work[limit], &work[2 * limit], &work[3 * limit], iwork,
+        last);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Adaptive integration over a finite range with user-supplied break
+ *           points and extrapolation by the epsilon algorithm (`dqagpe`).
+ *
+ * The subintervals between the sorted break points are the initial
+ * subintervals. In contrast to `integratecpp::quadpack::qagse`, subintervals
+ * are classified as large or small by their level of bisection instead of
+ * their length, as the initial subintervals may be of different lengths.
+ *
+ * \tparam   Rule_   a rule type like `integratecpp::quadpack::qk21_rule`.
+ *
+ * \param    rule    the rule applied to subintervals.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    npts2   an `int` for the number of break points plus `2`.
+ * \param    points  the `npts2 - 2` break points in any order.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    limit   an `int` for the maximum number of subintervals, which
+ *                   must be at least `npts2 - 1`.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    ier     the error code as in `Rdqags`.
+ * \param    alist   the lower bounds of the subintervals.
+ * \param    blist   the upper bounds of the subintervals.
+ * \param    rlist   the integral approximations on the subintervals.
+ * \param    elist   the error estimates on the subintervals.
+ * \param    pts     the sorted integration limits and break points of size
+ *                   `npts2`.
+ * \param    iord    the (one-based) indices of the subintervals ordered by
+ *                   their error estimates.
+ * \param    level   the levels of bisection of the subintervals.
+ * \param    ndin    flags of size `npts2` for the initial subintervals whose
+ *                   error estimates were increased as their rule applications
+ *                   were unreliable.
+ * \param    last    the number of subintervals.
+ */
+template <typename Rule_>
+inline void qagpe(const Rule_ &rule, const double a, const double b,
+                  const int npts2, const double *points, const double epsabs,
+                  const double epsrel, const int limit, double &result,
+                  double &abserr, int &neval, int &ier, double *alist,
+                  double *blist, double *rlist, double *elist, double *pts,
+                  int *iord, int *level, int *ndin, int &last) {
+    // NOTE: test on validity of parameters
+    ier = 0;
+    neval = 0;
+    last = 0;
+    result = 0.;
+    abserr = 0.;
+    alist[0] = a;
+    blist[0] = b;
+    rlist[0] = 0.;
+    elist[0] = 0.;
+    iord[0] = 0;
+    level[0] = 0;
+    const auto npts = npts2 - 2;
+    if (npts2 < 2 || limit <= npts ||
+        (epsabs <= 0. && epsrel < std::max(epmach() * 50., 0.5e-28))) {
+        ier = 6;
+        return;
+    }
+
+    // NOTE: if any break points are provided, sort them into an ascending
+    // sequence.
+    const auto sign = a > b ? -1. : 1.;
+    pts[0] = std::min(a, b);
+    std::copy_n(points, npts, &pts[1]);
+    pts[npts + 1] = std::max(a, b);
+    const auto nint = npts + 1;
+    std::sort(&pts[1], &pts[npts + 1]);
+    if (pts[1] < pts[0] || pts[npts] > pts[npts + 1]) {
+        ier = 6;
+        return;
+    }
+
+    // NOTE: compute first integral and error approximations.
+    auto resabs = 0.;
+    for (auto i = 0; i < nint; ++i) {
+        const auto a1 = pts[i];
+        const auto b1 = pts[i + 1];
+        auto area1 = 0.;
+        auto error1 = 0.;
+        auto defabs = 0.;
+        auto resa = 0.;
+        rule(a1, b1, area1, error1, defabs, resa);
+        abserr += error1;
+        result += area1;
+        ndin[i] = error1 == resa && error1 != 0. ? 1 : 0;
+        resabs += defabs;
+        level[i] = 0;
+        elist[i] = error1;
+        alist[i] = a1;
+        blist[i] = b1;
+        rlist[i] = area1;
+        iord[i] = i + 1;
+    }
+    auto errsum = 0.;
+    for (auto i = 0; i < nint; ++i) {
+        if (ndin[i] == 1) {
+            elist[i] = abserr;
+        }
+        errsum += elist[i];
+    }
+
+    // NOTE: test on accuracy.
+    last = nint;
+    neval = rule.neval() * nint;
+    const auto dres = std::abs(result);
+    auto errbnd = std::max(epsabs, epsrel * dres);
+    if (abserr <= epmach() * 100. * resabs && abserr > errbnd) {
+        ier = 2;
+    }
+    if (nint > 1) {
+        // NOTE: order the initial subintervals by decreasing error estimates.
+        for (auto i = 0; i < npts; ++i) {
+            auto ind1 = iord[i];
+            auto k = i;
+            for (auto j = i + 1; j < nint; ++j) {
+                const auto ind2 = iord[j];
+                if (elist[ind1 - 1] <= elist[ind2 - 1]) {
+                    ind1 = ind2;
+                    k = j;
+                }
+            }
+            if (ind1 != iord[i]) {
+                iord[k] = iord[i];
+                iord[i] = ind1;
+            }
+        }
+        if (limit < npts2) {
+            ier = 1;
+        }
+    }
+    if (ier != 0 || abserr <= errbnd) {
+        if (ier > 2) {
+            --ier;
+        }
+        result *= sign;
+        return;
+    }
+
+    // NOTE: initialization
+    double rlist2[52], res3la[3];
+    rlist2[0] = result;
+    auto maxerr = iord[0];
+    auto errmax = elist[maxerr - 1];
+    auto area = result;
+    auto nrmax = 1;
+    auto nres = 0;
+    auto numrl2 = 1;
+    auto ktmin = 0;
+    auto extrap = false;
+    auto noext = false;
+    auto erlarg = errsum;
+    auto ertest = errbnd;
+    auto levmax = 1;
+    auto iroff1 = 0;
+    auto iroff2 = 0;
+    auto iroff3 = 0;
+    auto ierro = 0;
+    abserr = oflow();
+    const auto ksgn = dres >= (1. - epmach() * 50.) * resabs ? 1 : -1;
+    auto correc = 0.;
+
+    // NOTE: `sum_up` marks exits which compute the result as sum over all
+    // subintervals.
+    auto sum_up = false;
+
+    // NOTE: main loop
+    for (last = npts2; last <= limit; ++last) {
+        // NOTE: bisect the subinterval with the nrmax-th largest error
+        // estimate.
+        const auto levcur = level[maxerr - 1] + 1;
+        const auto a1 = alist[maxerr - 1];
+        const auto b1 = (alist[maxerr - 1] + blist[maxerr - 1]) * .5;
+        const auto a2 = b1;
+        const auto b2 = blist[maxerr - 1];
+        const auto erlast = errmax;
+        auto area1 = 0.;
+        auto error1 = 0.;
+        auto defab1 = 0.;
+        auto area2 = 0.;
+        auto error2 = 0.;
+        auto defab2 = 0.;
+        auto resa = 0.;
+        rule(a1, b1, area1, error1, resa, defab1);
+        rule(a2, b2, area2, error2, resa, defab2);
+
+        // NOTE: improve previous approximations to integral and error and
+        // test for accuracy.
+        neval += 2 * rule.neval();
+        const auto area12 = area1 + area2;
+        const auto erro12 = error1 + error2;
+        errsum = errsum + erro12 - errmax;
+        area = area + area12 - rlist[maxerr - 1];
+        if (!(defab1 == error1 || defab2 == error2)) {
+            if (!(std::abs(rlist[maxerr - 1] - area12) >
+                      std::abs(area12) * 1e-5 ||
+                  erro12 < errmax * .99)) {
+                if (extrap) {
+                    ++iroff2;
+                } else {
+                    ++iroff1;
+                }
+            }
+            if (last > 10 && erro12 > errmax) {
+                ++iroff3;
+            }
+        }
+        level[maxerr - 1] = levcur;
+        level[last - 1] = levcur;
+        rlist[maxerr - 1] = area1;
+        rlist[last - 1] = area2;
+        errbnd = std::max(epsabs, epsrel * std::abs(area));
+
+        // NOTE: test for roundoff error and eventually set error flag.
+        if (iroff1 + iroff2 >= 10 || iroff3 >= 20) {
+            ier = 2;
+        }
+        if (iroff2 >= 5) {
+            ierro = 3;
+        }
+
+        // NOTE: set error flag in the case that the number of subintervals
+        // equals limit.
+        if (last == limit) {
+            ier = 1;
+        }
+
+        // NOTE: set error flag in the case of bad integrand behaviour at a
+        // point of the integration range.
+        if (std::max(std::abs(a1), std::abs(b2)) <=
+            (epmach() * 100. + 1.) * (std::abs(a2) + uflow() * 1e3)) {
+            ier = 4;
+        }
+
+        // NOTE: append the newly-created intervals to the list.
+        if (error2 > error1) {
+            alist[maxerr - 1] = a2;
+            alist[last - 1] = a1;
+            blist[last - 1] = b1;
+            rlist[maxerr - 1] = area2;
+            rlist[last - 1] = area1;
+            elist[maxerr - 1] = error2;
+            elist[last - 1] = error1;
+        } else {
+            alist[last - 1] = a2;
+            blist[maxerr - 1] = b1;
+            blist[last - 1] = b2;
+            elist[maxerr - 1] = error1;
+            elist[last - 1] = error2;
+        }
+
+        // NOTE: maintain the descending ordering in the list of error
+        // estimates and select the subinterval with nrmax-th largest error
+        // estimate (to be bisected next).
+        qpsrt(limit, last, maxerr, errmax, elist, iord, nrmax);
+        if (errsum <= errbnd) {
+            sum_up = true;
+            break;
+        }
+        if (ier != 0) {
+            break;
+        }
+        if (noext) {
+            continue;
+        }
+        erlarg -= erlast;
+        if (levcur + 1 <= levmax) {
+            erlarg += erro12;
+        }
+        if (!extrap) {
+            // NOTE: test whether the interval to be bisected next is the
+            // smallest interval.
+            if (level[maxerr - 1] + 1 <= levmax) {
+                continue;
+            }
+            extrap = true;
+            nrmax = 2;
+        }
+
+        if (ierro != 3 && erlarg > ertest) {
+            // NOTE: the smallest interval has the largest error. before
+            // bisecting decrease the sum of the errors over the larger
+            // intervals (erlarg) and perform extrapolation.
+            const auto id = nrmax;
+            const auto jupbnd =
+                last > limit / 2 + 2 ? limit + 3 - last : last;
+            auto large = false;
+            for (auto k = id; k <= jupbnd; ++k) {
+                maxerr = iord[nrmax - 1];
+                errmax = elist[maxerr - 1];
+                if (level[maxerr - 1] + 1 <= levmax) {
+                    large = true;
+                    break;
+                }
+                ++nrmax;
+            }
+            if (large) {
+                continue;
+            }
+        }
+
+        // NOTE: perform extrapolation.
+        ++numrl2;
+        rlist2[numrl2 - 1] = area;
+        if (numrl2 > 2) {
+            auto reseps = 0.;
+            auto abseps = 0.;
+            qelg(numrl2, rlist2, reseps, abseps, res3la, nres);
+            ++ktmin;
+            if (ktmin > 5 && abserr < errsum * .001) {
+                ier = 5;
+            }
+            if (abseps < abserr) {
+                ktmin = 0;
+                abserr = abseps;
+                result = reseps;
+                correc = erlarg;
+                ertest = std::max(epsabs, epsrel * std::abs(reseps));
+                if (abserr < ertest) {
+                    break;
+                }
+            }
+
+            // NOTE: prepare bisection of the smallest interval.
+            if (numrl2 == 1) {
+                noext = true;
+            }
+            if (ier >= 5) {
+                break;
+            }
+        }
+        maxerr = iord[0];
+        errmax = elist[maxerr - 1];
+        nrmax = 1;
+        extrap = false;
+        ++levmax;
+        erlarg = errsum;
+    }
+
+    // NOTE: set final result and error estimate.
+    if (!sum_up) {
+        auto test_divergence = true;
+        if (abserr == oflow()) {
+            sum_up = true;
+        } else if (ier + ierro != 0) {
+            if (ierro == 3) {
+                abserr += correc;
+            }
+            if (ier == 0) {
+                ier = 3;
+            }
+            if (result != 0. && area != 0.) {
+                if (abserr / std::abs(result) > errsum / std::abs(area)) {
+                    sum_up = true;
+                }
+            } else if (abserr > errsum) {
+                sum_up = true;
+            } else if (area == 0.) {
+                test_divergence = false;
+            }
+        }
+
+        // NOTE: test on divergence.
+        if (!sum_up && test_divergence &&
+            !(ksgn == -1 &&
+              std::max(std::abs(result), std::abs(area)) <= resabs * .01)) {
+            if (.01 > result / area || result / area > 100. ||
+                errsum > std::abs(area)) {
+                ier = 6;
+            }
+        }
+    }
+
+    // NOTE: compute global integral sum.
+    if (sum_up) {
+        result = 0.;
+        for (auto k = 0; k < last; ++k) {
+            result += rlist[k];
+        }
+        abserr = errsum;
+    }
+
+    if (ier > 2) {
+        --ier;
+    }
+    result *= sign;
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Computes a definite integral over a finite range with
+ *           user-supplied break points (`dqagp`).
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    npts2   an `int` for the number of break points plus `2`.
+ * \param    points  the `npts2 - 2` break points in any order.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    ier     the error code as in `Rdqags`.
+ * \param    limit   an `int` for the maximum number of subintervals.
+ * \param    lenw    an `int` for the size of the working array.
+ * \param    last    the number of subintervals.
+ * \param    iwork   an index array of size `2 * limit + npts2`.
+ * \param    work    a working array of size `lenw`, which must be at least
+ *                   `4 * limit + npts2`.
+ */
+template <typename Integrand_>
+inline void qagp(Integrand_ &f, const double a, const double b,
+                 const int npts2, const double *points, const double epsabs,
+                 const double epsrel, double &result, double &abserr,
+                 int &neval, int &ier, const int limit, const int lenw,
+                 int &last, int *iwork, double *work) {
+    ier = 6;
+    neval = 0;
+    last = 0;
+    result = 0.;
+    abserr = 0.;
+    if (limit < 1 || npts2 < 2 || lenw < limit * 4 + npts2) {
+        return;
+    }
+    const auto rule = qk21_rule<Integrand_>{f};
+    qagpe(rule, a, b, npts2, points, epsabs, epsrel, limit, result, abserr,
+          neval, ier, &work[0], &work[limit], &work[2 * limit],
+          &work[3 * limit], &work[4 * limit], iwork, &iwork[limit],
+          &iwork[2 * limit], last);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Globally adaptive integration without extrapolation (`dqage`).
+ *
+ * The subinterval with the largest error estimate is bisected until the
+ * requested accuracy is achieved, without the extrapolation table of
+ * `integratecpp::quadpack::qagse`. This avoids its overhead for smooth
+ * integrands, for which higher-order rules need fewer subdivisions.
+ *
+ * \tparam   Rule_   a rule type like
+ *                   `integratecpp::quadpack::gauss_kronrod_rule`.
+ *
+ * \param    rule    the rule applied to subintervals.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    limit   an `int` for the maximum number of subintervals.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    ier     the error code as in `Rdqags`; `4` and `5` do not occur.
+ * \param    alist   the lower bounds of the subintervals.
+ * \param    blist   the upper bounds of the subintervals.
+ * \param    rlist   the integral approximations on the subintervals.
+ * \param    elist   the error estimates on the subintervals.
+ * \param    iord    the (one-based) indices of the subintervals in descending
+ *                   order of their error estimates.
+ * \param    last    the number of subintervals.
+ */
+template <typename Rule_>
+inline void qage(const Rule_ &rule, const double a, const double b,
+                 const double epsabs, const double epsrel, const int limit,
+                 double &result, double &abserr, int &neval, int &ier,
+                 double *alist, double *blist, double *rlist, double *elist,
+                 int *iord, int &last) {
+    // NOTE: test on validity of parameters
+    ier = 0;
+    neval = 0;
+    last = 0;
+    result = 0.;
+    abserr = 0.;
+    alist[0] = a;
+    blist[0] = b;
+    rlist[0] = 0.;
+    elist[0] = 0.;
+    iord[0] = 0;
+    if (epsabs <= 0. && epsrel < std::max(epmach() * 50., 0.5e-28)) {
+        ier = 6;
+        return;
+    }
+
+    // NOTE: first approximation to the integral
+    auto defabs = 0.;
+    auto resabs = 0.;
+    rule(a, b, result, abserr, defabs, resabs);
+
+    // NOTE: test on accuracy.
+    last = 1;
+    rlist[0] = result;
+    elist[0] = abserr;
+    iord[0] = 1;
+    auto errbnd = std::max(epsabs, epsrel * std::abs(result));
+    if (abserr <= epmach() * 50. * defabs && abserr > errbnd) {
+        ier = 2;
+    }
+    if (limit == 1) {
+        ier = 1;
+    }
+    if (ier != 0 || (abserr <= errbnd && abserr != resabs) || abserr == 0.) {
+        neval = rule.neval();
+        return;
+    }
+
+    // NOTE: initialization
+    auto errmax = abserr;
+    auto maxerr = 1;
+    auto area = result;
+    auto errsum = abserr;
+    auto nrmax = 1;
+    auto iroff1 = 0;
+    auto iroff2 = 0;
+
+    // NOTE: main loop
+    for (last = 2; last <= limit; ++last) {
+        // NOTE: bisect the subinterval with the largest error estimate.
+        const auto a1 = alist[maxerr - 1];
+        const auto b1 = (alist[maxerr - 1] + blist[maxerr - 1]) * .5;
+        const auto a2 = b1;
+        const auto b2 = blist[maxerr - 1];
+        auto area1 = 0.;
+        auto error1 = 0.;
+        auto defab1 = 0.;
+        auto area2 = 0.;
+        auto error2 = 0.;
+        auto defab2 = 0.;
+        rule(a1, b1, area1, error1, resabs, defab1);
+        rule(a2, b2, area2, error2, resabs, defab2);
+
+        // NOTE: improve previous approximations to integral and error and
+        // test for accuracy.
+        const auto area12 = area1 + area2;
+        const auto erro12 = error1 + error2;
+        errsum = errsum + erro12 - errmax;
+        area = area + area12 - rlist[maxerr - 1];
+        if (defab1 != error1 && defab2 != error2) {
+            if (std::abs(rlist[maxerr - 1] - area12) <=
+                    1e-5 * std::abs(area12) &&
+                erro12 >= .99 * errmax) {
+                ++iroff1;
+            }
+            if (last > 10 && erro12 > errmax) {
+                ++iroff2;
+            }
+        }
+        rlist[maxerr - 1] = area1;
+        rlist[last - 1] = area2;
+        errbnd = std::max(epsabs, epsrel * std::abs(area));
+        if (errsum > errbnd) {
+            // NOTE: test for roundoff error and eventually set error flag.
+            if (iroff1 >= 6 || iroff2 >= 20) {
+                ier = 2;
+            }
+
+            // NOTE: set error flag in the case that the number of
+            // subintervals equals limit.
+            if (last == limit) {
+                ier = 1;
+            }
+
+            // NOTE: set error flag in the case of bad integrand behaviour
+            // at a point of the integration range.
+            if (std::max(std::abs(a1), std::abs(b2)) <=
+                (epmach() * 100. + 1.) * (std::abs(a2) + uflow() * 1000.)) {
+                ier = 3;
+            }
+        }
+
+        // NOTE: append the newly-created intervals to the list.
+        if (error2 > error1) {
+            alist[maxerr - 1] = a2;
+            alist[last - 1] = a1;
+            blist[last - 1] = b1;
+            rlist[maxerr - 1] = area2;
+            rlist[last - 1] = area1;
+            elist[maxerr - 1] = error2;
+            elist[last - 1] = error1;
+        } else {
+            alist[last - 1] = a2;
+            blist[maxerr - 1] = b1;
+            blist[last - 1] = b2;
+            elist[maxerr - 1] = error1;
+            elist[last - 1] = error2;
+        }
+
+        // NOTE: call `qpsrt` to maintain the descending ordering in the list
+        // of error estimates and select the subinterval with the largest
+        // error estimate (to be bisected next).
+        qpsrt(limit, last, maxerr, errmax, elist, iord, nrmax);
+        if (ier != 0 || errsum <= errbnd) {
+            break;
+        }
+    }
+
+    // NOTE: compute final result.
+    result = 0.;
+    for (auto k = 0; k < last; ++k) {
+        result += rlist[k];
+    }
+    abserr = errsum;
+    neval = rule.neval() * (2 * last - 1);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Computes a definite integral over a finite range with a
+ *           Gauss-Kronrod rule of `points` points and without extrapolation
+ *           (`dqag`).
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    points  an `int` for the number of points of the rule: `15`,
+ *                   `21`, `31`, `41`, `51`, or `61`.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    ier     the error code as in `Rdqags`.
+ * \param    limit   an `int` for the maximum number of subintervals.
+ * \param    lenw    an `int` for the size of the working array.
+ * \param    last    the number of subintervals.
+ * \param    iwork   an index array of size `limit`.
+ * \param    work    a working array of size `lenw`.
+ */
+template <typename Integrand_>
+inline void qag(Integrand_ &f, const double a, const double b,
+                const double epsabs, const double epsrel, const int points,
+                double &result, double &abserr, int &neval, int &ier,
+                const int limit, const int lenw, int &last, int *iwork,
+                double *work) {
+    ier = 6;
+    neval = 0;
+    last = 0;
+    result = 0.;
+    abserr = 0.;
+    if (limit < 1 || lenw < limit * 4) {
+        return;
+    }
+    const auto rule = gauss_kronrod_rule<Integrand_>{f, points};
+    qage(rule, a, b, epsabs, epsrel, limit, result, abserr, neval, ier,
+         &work[0], &work[limit], &work[2 * limit], &work[3 * limit], iwork,
+         last);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Globally adaptive integration without extrapolation (as `dqage`),
+ *           bisecting the `nbisect` subintervals with the largest error
+ *           estimates at once and applying the rule to the new subintervals
+ *           concurrently.
+ *
+ * The subintervals are selected from a binary max-heap of error estimates and
+ * the results of a round are combined in a fixed order, i.e., the results do
+ * not depend on the number of workers of `pool`. Subintervals beyond the first
+ * of a round are only bisected if their error estimate is at least a
+ * hundredth of the largest, and the tests for roundoff errors only consider
+ * the first, which is the one `dqage` would bisect.
+ *
+ * \tparam   Rule_   a rule type like `integratecpp::quadpack::qk21_rule`,
+ *                   which is applied concurrently.
+ * \tparam   Pool_   a pool type like `integratecpp::detail::work_stealing_pool`.
+ *
+ * \param    rule     the rule applied to subintervals.
+ * \param    pool     the pool applying the rule concurrently.
+ * \param    a        a `double` for the lower bound.
+ * \param    b        a `double` for the upper bound.
+ * \param    epsabs   a `double` for the requested absolute accuracy.
+ * \param    epsrel   a `double` for the requested relative accuracy.
+ * \param    limit    an `int` for the maximum number of subintervals.
+ * \param    nbisect  an `int` for the number of subintervals bisected at once.
+ * \param    result   the approximated integral.
+ * \param    abserr   the estimated absolute error.
+ * \param    neval    the number of function evaluations.
+ * \param    ier      the error code as in `Rdqags`.
+ * \param    alist    the lower bounds of the subintervals.
+ * \param    blist    the upper bounds of the subintervals.
+ * \param    rlist    the integral approximations on the subintervals.
+ * \param    elist    the error estimates on the subintervals.
+ * \param    iord     the heap of (one-based) indices of the subintervals.
+ * \param    last     the number of subintervals.
+ *
+ * \exception  rethrows the exception of the first rule application, in the
+ *             fixed order, during which the integrand threw.
+ */
+template <typename Rule_, typename Pool_>
+inline void qage_parallel(const Rule_ &rule, Pool_ &pool, const double a,
+                          const double b, const double epsabs,
+                          const double epsrel, const int limit,
+                          const int nbisect, double &result, double &abserr,
+                          int &neval, int &ier, double *alist, double *blist,
+                          double *rlist, double *elist, int *iord, int &last) {
+    // NOTE: test on validity of parameters
+    ier = 0;
+    neval = 0;
+    last = 0;
+    result = 0.;
+    abserr = 0.;
+    alist[0] = a;
+    blist[0] = b;
+    rlist[0] = 0.;
+    elist[0] = 0.;
+    if (epsabs <= 0. && epsrel < std::max(epmach() * 50., 0.5e-28)) {
+        ier = 6;
+        return;
+    }
+
+    // NOTE: first approximation to the integral
+    auto defabs = 0.;
+    auto resabs = 0.;
+    rule(a, b, result, abserr, defabs, resabs);
+
+    // NOTE: test on accuracy.
+    auto errbnd = std::max(epsabs, epsrel * std::abs(result));
+    last = 1;
+    rlist[0] = result;
+    elist[0] = abserr;
+    if (abserr <= epmach() * 50. * defabs && abserr > errbnd) {
+        ier = 2;
+    }
+    if (limit == 1) {
+        ier = 1;
+    }
+    if (ier != 0 || (abserr <= errbnd && abserr != resabs) || abserr == 0.) {
+        neval = rule.neval();
+        return;
+    }
+
+    // NOTE: initialization
+    const auto less = [elist](const int i, const int j) {
+        return elist[i - 1] < elist[j - 1];
+    };
+    iord[0] = 1;
+    auto nheap = 1;
+    auto area = result;
+    auto errsum = abserr;
+    auto iroff1 = 0;
+    auto iroff2 = 0;
+    auto bad_point = false;
+
+    // NOTE: the subintervals and results of the rule applications of a round.
+    struct application_type {
+        double a;
+        double b;
+        double area;
+        double error;
+        double resabs;
+        double defab;
+        std::exception_ptr e_ptr;
+    };
+    auto maxerrs = std::vector<int>(nbisect);
+    auto applications = std::vector<application_type>(2 * nbisect);
+
+    // NOTE: main loop
+    while (last < limit) {
+        // NOTE: bisect the subintervals with the largest error estimates.
+        const auto nmax = std::min(nbisect, limit - last);
+        const auto errmin = elist[iord[0] - 1] * .01;
+        auto nround = 0;
+        for (; nround < nmax && nheap > 0; ++nround) {
+            if (nround > 0 && elist[iord[0] - 1] < errmin) {
+                break;
+            }
+            std::pop_heap(iord, iord + nheap, less);
+            const auto maxerr = iord[--nheap];
+            const auto k = nround;
+            maxerrs[k] = maxerr;
+            applications[2 * k].a = alist[maxerr - 1];
+            applications[2 * k].b = (alist[maxerr - 1] + blist[maxerr - 1]) * .5;
+            applications[2 * k + 1].a = applications[2 * k].b;
+            applications[2 * k + 1].b = blist[maxerr - 1];
+        }
+        pool.parallel_for(
+            static_cast<std::size_t>(2 * nround),
+            [&](const int /* worker */, const std::size_t j) {
+                auto &application = applications[j];
+                application.e_ptr = nullptr;
+                try {
+                    rule(application.a, application.b, application.area,
+                         application.error, application.resabs,
+                         application.defab);
+                } catch (...) {
+                    application.e_ptr = std::current_exception();
+                }
+            });
+        for (auto j = 0; j < 2 * nround; ++j) {
+            if (applications[j].e_ptr) {
+                std::rethrow_exception(applications[j].e_ptr);
+            }
+        }
+
+        // NOTE: improve previous approximations to integral and error and
+        // test for accuracy in the order of the bisected subintervals.
+        for (auto k = 0; k < nround; ++k) {
+            const auto maxerr = maxerrs[k];
+            const auto &first = applications[2 * k];
+            const auto &second = applications[2 * k + 1];
+            const auto errmax = elist[maxerr - 1];
+            const auto area12 = first.area + second.area;
+            const auto erro12 = first.error + second.error;
+            errsum = errsum + erro12 - errmax;
+            area = area + area12 - rlist[maxerr - 1];
+            if (k == 0 && first.defab != first.error &&
+                second.defab != second.error) {
+                if (std::abs(rlist[maxerr - 1] - area12) <=
+                        std::abs(area12) * 1e-5 &&
+                    erro12 >= errmax * .99) {
+                    ++iroff1;
+                }
+                if (last > 10 && erro12 > errmax) {
+                    ++iroff2;
+                }
+            }
+            ++last;
+            blist[maxerr - 1] = first.b;
+            rlist[maxerr - 1] = first.area;
+            elist[maxerr - 1] = first.error;
+            alist[last - 1] = second.a;
+            blist[last - 1] = second.b;
+            rlist[last - 1] = second.area;
+            elist[last - 1] = second.error;
+            iord[nheap++] = maxerr;
+            std::push_heap(iord, iord + nheap, less);
+            iord[nheap++] = last;
+            std::push_heap(iord, iord + nheap, less);
+            if (std::max(std::abs(first.a), std::abs(second.b)) <=
+                (epmach() * 100. + 1.) * (std::abs(second.a) + uflow() * 1e3)) {
+                bad_point = true;
+            }
+        }
+
+        // NOTE: without extrapolation, divergence is only detected by
+        // overflow.
+        if (!std::isfinite(area) || !std::isfinite(errsum)) {
+            ier = 5;
+            break;
+        }
+        errbnd = std::max(epsabs, epsrel * std::abs(area));
+        if (errsum <= errbnd) {
+            break;
+        }
+
+        // NOTE: test for roundoff error, the number of subintervals, and
+        // bad integrand behaviour at a point of the integration range, once
+        // the round has not converged.
+        if (iroff1 >= 6 || iroff2 >= 20) {
+            ier = 2;
+        }
+        if (last == limit) {
+            ier = 1;
+        }
+        if (bad_point) {
+            ier = 3;
+        }
+        if (ier != 0) {
+            break;
+        }
+    }
+
+    // NOTE: compute global integral sum.
+    result = 0.;
+    for (auto k = 0; k < last; ++k) {
+        result += rlist[k];
+    }
+    abserr = errsum;
+    neval = rule.neval() * (2 * last - 1);
+}
+
+}  // namespace quadpack
+//! \endcond
+
+// -----------------------------------------------------------------------------
+// Implementations of the double exponential rules in
+// integratecpp::double_exponential
+// -----------------------------------------------------------------------------
+
+//! \cond INTERNAL
+namespace double_exponential {
+
+/*!
+ * \internal
+ *
+ * \brief    Double exponential quadrature over finite, half-infinite, and
+ *           infinite ranges.
+ *
+ * A substitution `x = x(u)` maps the real line onto the range such that the
+ * transformed integrand `f(x(u)) x'(u)` decays double exponentially in `u`,
+ * also for integrands with algebraic or logarithmic singularities at finite
+ * bounds or algebraically decaying tails. The trapezoidal rule with step size
+ * `2^-k` in `u` then converges exponentially in `2^k`. With
+ * `s(u) = pi / 2 * sinh(u)`, the substitutions are
+ *
+ * - tanh-sinh: `x = c + h * tanh(s(u))` for a finite range with centre `c`
+ *   and half-length `h`,
+ * - exp-sinh: `x = a + exp(s(u))` for `[a, inf)`, and
+ * - sinh-sinh: `x = sinh(s(u))` for `(-inf, inf)`.
+ *
+ * The integrand has the same semantics as in `integratecpp::quadpack`.
+ */
+
+/*!
+ * \internal
+ *
+ * \brief    The level-nested nodes of a double exponential rule.
+ *
+ * Level `0` holds the nodes `u = 0, 1, 2, ...` and level `k > 0` the nodes
+ * `u = (2i - 1) / 2^k` added by halving the step size, i.e., the trapezoidal
+ * sum of level `k` is the sum of level `k - 1` and the sum over the nodes of
+ * level `k`. Only nonnegative `u` are stored, each with the abscissae and
+ * weights for `-u` (side `0`) and `u` (side `1`) in the parametrization of the
+ * substitution, e.g., the complement `1 - |tanh(s(u))|` for tanh-sinh, which
+ * resolves abscissae close to the bounds. Nodes are omitted where `s(u)`
+ * exceeds `-log(DBL_MIN) / 2`, which keeps abscissae and weights finite and
+ * normalized.
+ */
+class node_table {
+   public:
+    //! \internal
+    //! \brief The maximal level, i.e., the minimal step size is `2^-8`.
+    static constexpr int max_level = 8;
+
+    /*!
+     * \internal
+     *
+     * \tparam   Node_  A `Callable` type invocable with `double s`,
+     *                  `double *abscissa`, and `double *weight`, setting the
+     *                  abscissae and the weights `dx / ds` of both sides.
+     */
+    template <typename Node_>
+    explicit node_table(const Node_ &node) {
+        const auto half_pi = 2. * std::atan(1.);
+        const auto u_max =
+            std::asinh(-std::log(quadpack::uflow()) / (2. * half_pi));
+        for (auto level = 0; level <= max_level; ++level) {
+            offset_[level] = static_cast<int>(u_.size());
+            const auto step = std::ldexp(1., -level);
+            for (auto u = (level == 0 ? 0. : step); u <= u_max;
+                 u += (level == 0 ? 1. : 2.) * step) {
+                std::array<double, 2> abscissa, weight;
+                node(half_pi * std::sinh(u), abscissa.data(), weight.data());
+                // NOTE: chain rule for `ds / du`.
+                weight[0] *= half_pi * std::cosh(u);
+                weight[1] *= half_pi * std::cosh(u);
+                u_.push_back(u);
+                abscissa_.push_back(abscissa);
+                weight_.push_back(weight);
+            }
+        }
+        offset_[max_level + 1] = static_cast<int>(u_.size());
+    }
+
+    //! \internal
+    //! \brief The index of the first node of `level`.
+    int begin(const int level) const noexcept { return offset_[level]; }
+
+    //! \internal
+    //! \brief The index past the last node of `level`.
+    int end(const int level) const noexcept { return offset_[level + 1]; }
+
+    //! \internal
+    //! \brief The parameter `u` of node `i`.
+    double u(const int i) const noexcept { return u_[i]; }
+
+    //! \internal
+    //! \brief The abscissa of node `i` on `side`.
+    double abscissa(const int i, const int side) const noexcept {
+        return abscissa_[i][side];
+    }
+
+    //! \internal
+    //! \brief The weight `dx / du` of node `i` on `side`.
+    double weight(const int i, const int side) const noexcept {
+        return weight_[i][side];
+    }
+
+   private:
+    std::vector<double> u_;
+    std::vector<std::array<double, 2>> abscissa_;
+    std::vector<std::array<double, 2>> weight_;
+    int offset_[max_level + 2];
+};
+
+constexpr int node_table::max_level;
+
+/*!
+ * \internal
+ *
+ * \brief    Returns the nodes of the tanh-sinh rule on `[-1, 1]` as
+ *           complements `1 - |t|`, which are computed on first use and shared
+ *           by all integrations.
+ */
+inline const node_table &tanh_sinh_table() {
+    // NOTE: initialization of function-local statics is thread-safe in C++11.
+    static const node_table table{
+        [](const double s, double *abscissa, double *weight) {
+            const auto e = std::exp(-2. * s);
+            abscissa[0] = abscissa[1] = 2. * e / (1. + e);
+            weight[0] = weight[1] = 4. * e / ((1. + e) * (1. + e));
+        }};
+    return table;
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Returns the nodes of the exp-sinh rule on `[0, inf)`, which are
+ *           computed on first use and shared by all integrations.
+ */
+inline const node_table &exp_sinh_table() {
+    static const node_table table{
+        [](const double s, double *abscissa, double *weight) {
+            const auto e = std::exp(s);
+            abscissa[0] = weight[0] = 1. / e;
+            abscissa[1] = weight[1] = e;
+        }};
+    return table;
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Returns the nodes of the sinh-sinh rule on `(-inf, inf)`, which
+ *           are computed on first use and shared by all integrations.
+ */
+inline const node_table &sinh_sinh_table() {
+    static const node_table table{
+        [](const double s, double *abscissa, double *weight) {
+            abscissa[0] = -std::sinh(s);
+            abscissa[1] = std::sinh(s);
+            weight[0] = weight[1] = std::cosh(s);
+        }};
+    return table;
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Applies the trapezoidal rule to the nodes of a double exponential
+ *           rule, halving the step size until the requested accuracy is
+ *           achieved.
+ *
+ * Each level evaluates the integrand only at the nodes it adds, in calls of
+ * at most 64 abscissae, and reuses the sum of the previous levels. The error
+ * is estimated by the difference of the approximations of consecutive levels
+ * while the differences decrease doubly exponentially, and by the larger of
+ * the last two differences otherwise, e.g., for a kink within the range, where
+ * a single difference may be small by chance. The estimate is accepted from
+ * the fourth level on. From then on, the nodes of each
+ * side are truncated one unit of `u` after the last unit with a term
+ * exceeding the rounding error of the sum over all levels, but not below
+ * `u = 1`.
+ *
+ * \tparam   Abscissa_  A `Callable` type invocable with `double t`,
+ *                      `int side`, and `double &x`, setting the abscissa `x`
+ *                      for the tabulated abscissa `t` on `side` and returning
+ *                      `false` if it is to be skipped, e.g., as it rounds to
+ *                      a bound.
+ *
+ * \param    f         the integrand.
+ * \param    table     the `node_table` of the rule.
+ * \param    abscissa  an `Abscissa_` functor.
+ * \param    scale     a `double` multiplying the tabulated weights.
+ * \param    epsabs    a `double` for the requested absolute accuracy.
+ * \param    epsrel    a `double` for the requested relative accuracy.
+ * \param    limit     an `int` for the maximal number of levels.
+ * \param    result    the approximated integral.
+ * \param    abserr    the estimated absolute error.
+ * \param    neval     the number of function evaluations.
+ * \param    last      the number of levels used.
+ * \param    ier       the error code: `0` if the requested accuracy was
+ *                     achieved, `1` if not, e.g., for fewer than four levels,
+ *                     and `6` for invalid input.
+ */
+template <typename Integrand_, typename Abscissa_>
+inline void trapezoidal(Integrand_ &f, const node_table &table,
+                        const Abscissa_ &abscissa, const double scale,
+                        const double epsabs, const double epsrel,
+                        const int limit, double &result, double &abserr,
+                        int &neval, int &last, int &ier) {
+    static constexpr int chunk_size = 64;
+    // NOTE: levels `0` to `2` may miss features between their nodes such that
+    // consecutive approximations agree by chance.
+    static constexpr int min_levels = 4;
+    static constexpr int units = 8;
+    double vec[chunk_size], wts[chunk_size], absc[chunk_size];
+    int side[chunk_size];
+
+    // NOTE: test on validity of parameters
+    result = 0.;
+    abserr = 0.;
+    neval = 0;
+    last = 0;
+    ier = 6;
+    if ((epsabs <= 0. &&
+         epsrel < std::max(quadpack::epmach() * 50., 0.5e-28)) ||
+        limit < 1) {
+        return;
+    }
+    const auto dscale = std::abs(scale);
+    const auto levels = std::min(limit, node_table::max_level + 1);
+    ier = 1;
+
+    // NOTE: collects the abscissae of node `i` on both sides within the
+    // truncation `u_max`; both sides coincide for `u = 0`.
+    double u_max[2] = {table.u(table.end(0) - 1), table.u(table.end(0) - 1)};
+    auto n = 0;
+    const auto collect = [&](const int i) {
+        for (auto s = table.u(i) == 0. ? 1 : 0; s < 2; ++s) {
+            if (table.u(i) <= u_max[s] &&
+                abscissa(table.abscissa(i, s), s, vec[n])) {
+                wts[n] = table.weight(i, s);
+                absc[n] = table.u(i);
+                side[n++] = s;
+            }
+        }
+    };
+
+    // NOTE: `peak` holds the largest term per side and unit of `u` over all
+    // levels; the node `u = 0` counts for both sides.
+    auto sum = 0.;
+    auto sumabs = 0.;
+    auto delta = 0.;
+    double peak[2][units] = {};
+    const auto flush = [&]() {
+        f(vec, n);
+        neval += n;
+        for (auto j = 0; j < n; ++j) {
+            const auto term = wts[j] * std::abs(vec[j]);
+            sum += wts[j] * vec[j];
+            sumabs += term;
+            const auto unit = std::min(static_cast<int>(absc[j]), units - 1);
+            for (auto s = absc[j] == 0. ? 0 : side[j]; s <= side[j]; ++s) {
+                peak[s][unit] = std::max(peak[s][unit], term);
+            }
+        }
+    };
+
+    for (auto level = 0; level < levels; ++level) {
+        n = 0;
+        for (auto i = table.begin(level); i < table.end(level); ++i) {
+            collect(i);
+            if (n > chunk_size - 2) {
+                flush();
+                n = 0;
+            }
+        }
+        if (n > 0) {
+            flush();
+        }
+        last = level + 1;
+
+        // NOTE: test for convergence.
+        const auto previous = result;
+        result = std::ldexp(sum, -level) * scale;
+        const auto resabs = std::ldexp(sumabs, -level) * dscale;
+        const auto previous_delta = delta;
+        delta = level == 0 ? resabs : std::abs(result - previous);
+        abserr = delta;
+        // NOTE: relative to `resabs`, the difference decreases at least
+        // quadratically for an integrand which is analytic within the range,
+        // until it reaches the rounding error of the sum.
+        if (delta > quadpack::epmach() * 50. * resabs &&
+            delta * resabs > previous_delta * previous_delta) {
+            abserr = std::max(delta, previous_delta);
+        }
+        if (resabs > quadpack::uflow() / (quadpack::epmach() * 50.)) {
+            abserr = std::max(quadpack::epmach() * 50. * resabs, abserr);
+        }
+        if (last < min_levels) {
+            continue;
+        }
+        if (abserr <= std::max(epsabs, epsrel * std::abs(result))) {
+            ier = 0;
+            return;
+        }
+
+        // NOTE: truncate the nodes of both sides for the following levels.
+        for (auto s = 0; s < 2; ++s) {
+            auto unit = units - 1;
+            while (unit > 0 &&
+                   peak[s][unit] <= quadpack::epmach() * sumabs) {
+                --unit;
+            }
+            u_max[s] = std::min(u_max[s], std::max(1., unit + 2.));
+        }
+    }
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Integration over a finite range by the tanh-sinh rule.
+ *
+ * Abscissae which round to a bound are skipped, i.e., singularities are
+ * resolved up to the spacing of doubles near the bound.
+ *
+ * \param    f       the integrand.
+ * \param    a       a `double` for the lower bound.
+ * \param    b       a `double` for the upper bound.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    limit   an `int` for the maximal number of levels.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    last    the number of levels used.
+ * \param    ier     the error code as in `trapezoidal()`.
+ */
+template <typename Integrand_>
+inline void tanh_sinh(Integrand_ &f, const double a, const double b,
+                      const double epsabs, const double epsrel,
+                      const int limit, double &result, double &abserr,
+                      int &neval, int &last, int &ier) {
+    if (a == b) {
+        result = 0.;
+        abserr = 0.;
+        neval = 0;
+        last = 0;
+        ier = 0;
+        return;
+    }
+    const auto hlgth = (b - a) * .5;
+    trapezoidal(
+        f, tanh_sinh_table(),
+        [a, b, hlgth](const double t, const int side, double &x) {
+            x = side == 0 ? a + hlgth * t : b - hlgth * t;
+            return x != a && x != b;
+        },
+        hlgth, epsabs, epsrel, limit, result, abserr, neval, last, ier);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Integration over a half-infinite range by the exp-sinh rule.
+ *
+ * Abscissae which round to the finite bound are skipped.
+ *
+ * \param    f       the integrand.
+ * \param    bound   a `double` for the finite bound.
+ * \param    inf     an `int` indicating the range: `1` for `(bound, inf)`
+ *                   and `-1` for `(-inf, bound)`.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    limit   an `int` for the maximal number of levels.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    last    the number of levels used.
+ * \param    ier     the error code as in `trapezoidal()`.
+ */
+template <typename Integrand_>
+inline void exp_sinh(Integrand_ &f, const double bound, const int inf,
+                     const double epsabs, const double epsrel,
+                     const int limit, double &result, double &abserr,
+                     int &neval, int &last, int &ier) {
+    const auto sign = inf == 1 ? 1. : -1.;
+    trapezoidal(
+        f, exp_sinh_table(),
+        [bound, sign](const double t, const int, double &x) {
+            x = bound + sign * t;
+            return x != bound;
+        },
+        1., epsabs, epsrel, limit, result, abserr, neval, last, ier);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Integration over the real line by the sinh-sinh rule.
+ *
+ * \param    f       the integrand.
+ * \param    epsabs  a `double` for the requested absolute accuracy.
+ * \param    epsrel  a `double` for the requested relative accuracy.
+ * \param    limit   an `int` for the maximal number of levels.
+ * \param    result  the approximated integral.
+ * \param    abserr  the estimated absolute error.
+ * \param    neval   the number of function evaluations.
+ * \param    last    the number of levels used.
+ * \param    ier     the error code as in `trapezoidal()`.
+ */
+template <typename Integrand_>
+inline void sinh_sinh(Integrand_ &f, const double epsabs, const double epsrel,
+                      const int limit, double &result, double &abserr,
+                      int &neval, int &last, int &ier) {
+    trapezoidal(
+        f, sinh_sinh_table(),
+        [](const double t, const int, double &x) {
+            x = t;
+            return true;
+        },
+        1., epsabs, epsrel, limit, result, abserr, neval, last, ier);
+}
+
+}  // namespace double_exponential
+//! \endcond
+
+// -----------------------------------------------------------------------------
+// Implementations of internal helpers in integratecpp::detail
+// -----------------------------------------------------------------------------
+
+//! \cond INTERNAL
+namespace detail {
+
+/*!
+ * \internal
+ *
+ * \brief    Checks the validity of the configuration parameters without
+ *           throwing.
+ *
+ * \param    config  a `integratecpp::integrator::config_type`.
+ *
+ * \return   a `bool`, which is `false` if configuration parameters'
+ *           preconditions are not fulfilled.
+ */
+inline bool is_valid_config(const integrator::config_type &config) noexcept {
+    if (config.max_subdivisions <= 0) {
+        return false;
+    } else if (config.absolute_accuracy <= 0. &&
+               config.relative_accuracy <
+                   std::max(50. * std::numeric_limits<double>::epsilon(),
+                            0.5e-28)) {
+        return false;
+    } else if (config.work_size < 4 * config.max_subdivisions) {
+        return false;
+    } else if (config.rule_points != 15 && config.rule_points != 21 &&
+               config.rule_points != 31 && config.rule_points != 41 &&
+               config.rule_points != 51 && config.rule_points != 61) {
+        return false;
+#ifdef INTEGRATECPP_NO_R_API
+    } else if (config.backend == integrator::backend_type::r_api) {
+        return false;
+#endif
+    } else {
+        return true;
+    }
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Checks the validity of the configuration parameters.
+ *
+ * \param    config  a `integratecpp::integrator::config_type`.
+ *
+ * \exception  throws integratecpp::invalid_input_error if configuration
+ *             parameters' preconditions are not fulfilled.
+ */
+inline void throw_if_invalid_config(const integrator::config_type &config) {
+    if (!is_valid_config(config)) {
+        throw invalid_input_error("the input is invalid");
+    } else {
+        return;
+    }
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Checks the validity of the integration bounds.
+ *
+ * \param    lower  a `double` for the lower bound.
+ * \param    upper  a `double` for the upper bound.
+ *
+ * \exception  throws integratecpp::invalid_input_error if a bound is `NaN`.
+ */
+inline void throw_if_invalid_bounds(const double lower, const double upper) {
+    if (std::isnan(lower) || std::isnan(upper)) {
+        throw invalid_input_error("the input is invalid");
+    } else {
+        return;
+    }
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Checks the validity of the integration bounds and break points
+ *           for `dqagp`.
+ *
+ * \param    lower   a `double` for the lower bound.
+ * \param    upper   a `double` for the upper bound.
+ * \param    points  a `std::vector<double>` of break points.
+ * \param    config  a `integratecpp::integrator::config_type`.
+ *
+ * \exception  throws integratecpp::invalid_input_error if a bound is not
+ *             finite, if a break point is not between `lower` and `upper`, or
+ *             if `config.max_subdivisions` is less than the number of initial
+ *             subintervals.
+ */
+inline void throw_if_invalid_points(const double lower, const double upper,
+                                    const std::vector<double> &points,
+                                    const integrator::config_type &config) {
+    const auto min = std::min(lower, upper);
+    const auto max = std::max(lower, upper);
+    if (!std::isfinite(lower) || !std::isfinite(upper) ||
+        static_cast<std::size_t>(config.max_subdivisions) <= points.size() ||
+        !std::all_of(points.begin(), points.end(), [min, max](const double x) {
+            return min <= x && x <= max;
+        })) {
+        throw invalid_input_error("the input is invalid");
+    } else {
+        return;
+    }
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Translates error codes from `Rdqag[is]` to suitable exceptions
+ *           without throwing them.
+ *
+ * \param    error_code  an `int` with the error code of `Rdqag[is]`.
+ * \param    result      a `integratecpp::integrator::return_type` with the
+ *                       integration results at the time of error.
+ *
+ * \return   a `std::exception_ptr`, which is empty if `error_code == 0`.
+ */
+inline std::exception_ptr make_error(const int error_code,
+                                     const integrator::return_type &result) {
+    // NOTE: invalid argument errors should be caught during initialization
+    assert(error_code < 6);
+    if (error_code <= 0) {
+        return nullptr;
+    } else if (error_code == 1) {
+        return std::make_exception_ptr(max_subdivision_error(
+            "maximum number of subdivisions reached", result));
+    } else if (error_code == 2) {
+        return std::make_exception_ptr(
+            roundoff_error("roundoff error was detected", result));
+    } else if (error_code == 3) {
+        return std::make_exception_ptr(
+            bad_integrand_error("extremely bad integrand behaviour", result));
+    } else if (error_code == 4) {
+        return std::make_exception_ptr(extrapolation_roundoff_error(
+            "roundoff error is detected in the extrapolation table", result));
+    } else if (error_code == 5) {
+        return std::make_exception_ptr(
+            divergence_error("the integral is probably divergent", result));
+    } else {
+        return std::make_exception_ptr(std::logic_error(  // # nocov
+            "invalid argument errors should be caught during "
+            "initialization"));  // # nocov
+    }
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Translates error codes from `Rdqag[is]` and evaluation errors from
+ *           the integrand to suitable exceptions.
+ *
+ * \param    error_code  an `int` with the error code of `Rdqag[is]`.
+ * \param    e_ptr       a `std::exception_ptr` with a caught exception.
+ * \param    result      a `integratecpp::integrator::return_type` with the
+ *                       integration results at the time of error.
+ */
+inline void throw_if_error(const int error_code, std::exception_ptr e_ptr,
+                           const integrator::return_type &result) {
+    if (e_ptr) {
+        std::rethrow_exception(e_ptr);
+    }
+    if (error_code > 0) {
+        std::rethrow_exception(make_error(error_code, result));
+    }
+    return;
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Translates (semi-)infinite bounds to the finite bound and the
+ *           range indicator `inf` required by `Rdqagi`.
+ *
+ * \param    lower  a `double` for the lower bound.
+ * \param    upper  a `double` for the upper bound.
+ *
+ * \return   a `std::pair` of the finite bound and the range indicator.
+ */
+inline std::pair<double, int> translate_bounds(const double lower,
+                                               const double upper) {
+    int inf;
+    double bound;
+    if (std::isfinite(lower)) {
+        inf = 1;
+        bound = lower;
+    } else if (std::isfinite(upper)) {
+        inf = -1;
+        bound = upper;
+    } else {
+        inf = 2;
+        bound = 0.;
+    }
+    return std::make_pair(bound, inf);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Wraps a `Callable` invocable with `const double` or a vectorized
+ *           `Callable` as integrand with the semantics of `integr_fn`, i.e.,
+ *           the abscissae passed as array are replaced by the function values.
+ *
+ * Exceptions not deriving from `std::exception` are translated to
+ * `integratecpp::integration_runtime_error` and non-finite function values
+ * are reported by throwing `integratecpp::integration_runtime_error`.
+ *
+ * \tparam   UnaryRealFunction_  A `Callable` type invocable with
+ *                               `const double` and returning `double`, or a
+ *                               vectorized `Callable` type invocable with
+ *                               `const double *`, `double *`, and `int`.
+ */
+template <typename UnaryRealFunction_>
+class guarded_integrand {
+   private:
+    //! \internal
+    //! \brief The maximal number of abscissae passed at once to a vectorized
+    //!        `Callable`; sufficient for a single application of the 61-point
+    //!        rule and a chunk of the double exponential rules.
+    static constexpr int batch_size = 64;
+
+    UnaryRealFunction_ &fn_;
+
+    void evaluate(double *x, const int n, std::false_type) const {
+        std::transform(x, x + n, x, fn_);
+    }
+
+    void evaluate(double *x, const int n, std::true_type) const {
+        // NOTE: the abscissae are copied as vectorized `Callable`s must not be
+        // required to support aliasing input and output arrays.
+        std::array<double, batch_size> abscissae;
+        for (auto offset = 0; offset < n; offset += batch_size) {
+            const auto size = std::min(batch_size, n - offset);
+            std::copy_n(x + offset, size, abscissae.begin());
+            fn_(static_cast<const double *>(abscissae.data()), x + offset,
+                size);
+        }
+    }
+
+   public:
+    explicit guarded_integrand(UnaryRealFunction_ &fn) noexcept : fn_{fn} {}
+
+    void operator()(double *x, const int n) const {
+        try {
+            using is_vectorized =
+                type_traits::is_vectorized_integrand<UnaryRealFunction_>;
+            evaluate(x, n, is_vectorized{});
+        } catch (const std::exception &e) {
+            throw;
+        } catch (...) {
+            throw integration_runtime_error("Unknown error");
+        }
+
+        if (!std::all_of(x, x + n,
+                         [](const double y) { return std::isfinite(y); })) {
+            throw integration_runtime_error("non-finite function value");
+        }
+    }
+};
+
+template <typename UnaryRealFunction_>
+constexpr int guarded_integrand<UnaryRealFunction_>::batch_size;
+
+#ifndef INTEGRATECPP_NO_R_API
+
+/*!
+ * \internal
+ *
+ * \brief    Calls `Rdqags` or `Rdqagi` for validated configuration parameters
+ *           and bounds on index and working arrays of sufficient size.
+ *
+ * \tparam   UnaryRealFunction_  A `Callable` type invocable with
+ *                               `const double` and returning `double`.
+ *
+ * \param    fn      a `UnaryRealFunction_` functor.
+ * \param    lower   a `double` for the lower bound.
+ * \param    upper   a `double` for the upper bound.
+ * \param    config  a `integratecpp::integrator::config_type`.
+ * \param    iwork   a pointer to an index array of size
+ *                   `config.max_subdivisions`.
+ * \param    work    a pointer to a working array of size `config.work_size`.
+ * \param    ier     the error code of `Rdqag[is]`.
+ *
+ * \exception  rethrows caught exceptions that occur during the evaluation of
+ *             the integrand.
+ */
+template <typename UnaryRealFunction_>
+inline integrator::return_type r_api_qag(UnaryRealFunction_ &&fn, double lower,
+                                         double upper,
+                                         const integrator::config_type &config,
+                                         int *iwork, double *work, int &ier) {
+    using return_type = integrator::return_type;
+    using integrand_type = guarded_integrand<
+        typename std::remove_reference<UnaryRealFunction_>::type>;
+
+    // NOTE: create local copies for input variables and references to an
+    // instance of output variables (as `Rdqag[si]` interface requires pointers
+    // to non-const variables). use names as described in the API of
+    // `Rdqag[is]`.
+    auto limit = config.max_subdivisions;
+    auto epsrel = config.relative_accuracy;
+    auto epsabs = config.absolute_accuracy;
+    auto lenw = config.work_size;
+
+    auto out = return_type{};  // NOTE: construct returned object
+    auto &result = out.value;
+    auto &abserr = out.absolute_error;
+    auto &last = out.subdivisions;
+    auto &neval = out.neval;
+
+    // NOTE: create non-capturing callback Lambda (which can be implicitly
+    // converted to a function.-pointer of signature `integr_fn` aka
+    // `void(double *, int, void *)`).
+    // the actual integrand function is passed through the `void *` in the last
+    // argument alongside with a `std::exception_ptr` to capture exceptions
+    // during function evaluations. exceptions apart `std::bad_alloc` must not
+    // pass the `C` code; they are stored and all function values are set to
+    // zero.
+    using ex_t = std::pair<integrand_type, std::exception_ptr>;
+    const auto integrand_callback = [](double *x, int n, void *ex) {
+        auto &integrand = (*static_cast<ex_t *>(ex)).first;
+        auto &e_ptr = (*static_cast<ex_t *>(ex)).second;
+        try {
+            integrand(x, n);
+        } catch (const std::bad_alloc &e) {
+            // NOTE: memory allocation issues must not be ignored
+            throw;
+        } catch (...) {
+            std::fill_n(x, n, 0.);
+            e_ptr = std::current_exception();
+        }
+    };
+    auto ex = ex_t{integrand_type{fn}, std::exception_ptr()};
+    auto &e_ptr = ex.second;
+
+    if (std::isfinite(lower) && std::isfinite(upper)) {
+        Rdqags(integrand_callback, &ex, &lower, &upper, &epsabs, &epsrel,
+               &result, &abserr, &neval, &ier, &limit, &lenw, &last, iwork,
+               work);
+    } else {
+        // NOTE: boundary information requires a transformation for `Rdqagi`.
+        auto bounds_info = translate_bounds(lower, upper);
+        auto bound = std::move(bounds_info.first);
+        auto inf = std::move(bounds_info.second);
+
+        Rdqagi(integrand_callback, &ex, &bound, &inf, &epsabs, &epsrel, &result,
+               &abserr, &neval, &ier, &limit, &lenw, &last, iwork, work);
+    }
+
+    if (e_ptr) {
+        std::rethrow_exception(e_ptr);
+    }
+
+    return out;
+}
+
+#endif
+
+/*!
+ * \internal
+ *
+ * \brief    Calls the native ports of `Rdqags` or `Rdqagi` for validated
+ *           configuration parameters and bounds on index and working arrays
+ *           of sufficient size.
+ *
+ * \tparam   UnaryRealFunction_  A `Callable` type invocable with
+ *                               `const double` and returning `double`.
+ *
+ * \param    fn      a `UnaryRealFunction_` functor.
+ * \param    lower   a `double` for the lower bound.
+ * \param    upper   a `double` for the upper bound.
+ * \param    config  a `integratecpp::integrator::config_type`.
+ * \param    iwork   a pointer to an index array of size
+ *                   `config.max_subdivisions`.
+ * \param    work    a pointer to a working array of size `config.work_size`.
+ * \param    ier     the error code as in `Rdqag[is]`.
+ */
+template <typename UnaryRealFunction_>
+inline integrator::return_type native_qag(UnaryRealFunction_ &&fn,
+                                          const double lower,
+                                          const double upper,
+                                          const integrator::config_type &config,
+                                          int *iwork, double *work, int &ier) {
+    using return_type = integrator::return_type;
+    using integrand_type = guarded_integrand<
+        typename std::remove_reference<UnaryRealFunction_>::type>;
+
+    auto out = return_type{};  // NOTE: construct returned object
+
+    // NOTE: exceptions during function evaluations propagate directly
+    auto integrand = integrand_type{fn};
+    if (std::isfinite(lower) && std::isfinite(upper)) {
+        if (config.backend ==
+            integrator::backend_type::native_double_exponential) {
+            double_exponential::tanh_sinh(
+                integrand, lower, upper, config.absolute_accuracy,
+                config.relative_accuracy, config.max_subdivisions, out.value,
+                out.absolute_error, out.neval, out.subdivisions, ier);
+            return out;
+        }
+        // NOTE: the non-adaptive rules are tried before the adaptive bisection
+        auto qng_neval = 0;
+        if (config.backend == integrator::backend_type::native_qng) {
+            quadpack::qng(integrand, lower, upper, config.absolute_accuracy,
+                          config.relative_accuracy, out.value,
+                          out.absolute_error, qng_neval, ier);
+            if (ier == 0) {
+                out.subdivisions = 1;
+                out.neval = qng_neval;
+                return out;
+            }
+        }
+        if (config.backend == integrator::backend_type::native_qag) {
+            quadpack::qag(integrand, lower, upper, config.absolute_accuracy,
+                          config.relative_accuracy, config.rule_points,
+                          out.value, out.absolute_error, out.neval, ier,
+                          config.max_subdivisions, config.work_size,
+                          out.subdivisions, iwork, work);
+        } else if (config.backend == integrator::backend_type::native_heap) {
+            quadpack::qags<integrand_type, quadpack::heap_selection>(
+                integrand, lower, upper, config.absolute_accuracy,
+                config.relative_accuracy, out.value, out.absolute_error,
+                out.neval, ier, config.max_subdivisions, config.work_size,
+                out.subdivisions, iwork, work);
+        } else {
+            quadpack::qags(integrand, lower, upper, config.absolute_accuracy,
+                           config.relative_accuracy, out.value,
+                           out.absolute_error, out.neval, ier,
+                           config.max_subdivisions, config.work_size,
+                           out.subdivisions, iwork, work);
+        }
+        out.neval += qng_neval;
+    } else {
+        const auto bounds_info = translate_bounds(lower, upper);
+        if (config.backend ==
+            integrator::backend_type::native_double_exponential) {
+            if (bounds_info.second == 2) {
+                double_exponential::sinh_sinh(
+                    integrand, config.absolute_accuracy,
+                    config.relative_accuracy, config.max_subdivisions,
+                    out.value, out.absolute_error, out.neval,
+                    out.subdivisions, ier);
+            } else {
+                double_exponential::exp_sinh(
+                    integrand, bounds_info.first, bounds_info.second,
+                    config.absolute_accuracy, config.relative_accuracy,
+                    config.max_subdivisions, out.value, out.absolute_error,
+                    out.neval, out.subdivisions, ier);
+            }
+            return out;
+        }
+        if (config.backend == integrator::backend_type::native_heap) {
+            quadpack::qagi<integrand_type, quadpack::heap_selection>(
+                integrand, bounds_info.first, bounds_info.second,
+                config.absolute_accuracy, config.relative_accuracy, out.value,
+                out.absolute_error, out.neval, ier, config.max_subdivisions,
+                config.work_size, out.subdivisions, iwork, work);
+        } else {
+            quadpack::qagi(integrand, bounds_info.first, bounds_info.second,
+                           config.absolute_accuracy, config.relative_accuracy,
+                           out.value, out.absolute_error, out.neval, ier,
+                           config.max_subdivisions, config.work_size,
+                           out.subdivisions, iwork, work);
+        }
+    }
+
+    return out;
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Dispatches to the configured backend for validated configuration
+ *           parameters and bounds on index and working arrays of sufficient
+ *           size, reporting integration errors by their error code.
+ *
+ * \tparam   UnaryRealFunction_  A `Callable` type invocable with
+ *                               `const double` and returning `double`.
+ *
+ * \param    fn      a `UnaryRealFunction_` functor.
+ * \param    lower   a `double` for the lower bound.
+ * \param    upper   a `double` for the upper bound.
+ * \param    config  a `integratecpp::integrator::config_type`.
+ * \param    iwork   a pointer to an index array of size
+ *                   `config.max_subdivisions`.
+ * \param    work    a pointer to a working array of size `config.work_size`.
+ * \param    ier     the error code as in `Rdqag[is]`.
+ */
+template <typename UnaryRealFunction_>
+inline integrator::return_type qag(UnaryRealFunction_ &&fn, const double lower,
+                                   const double upper,
+                                   const integrator::config_type &config,
+                                   int *iwork, double *work, int &ier) {
+    ier = 0;
+#ifndef INTEGRATECPP_NO_R_API
+    if (config.backend == integrator::backend_type::r_api) {
+        return r_api_qag(std::forward<UnaryRealFunction_>(fn), lower, upper,
+                         config, iwork, work, ier);
+    }
+#endif
+    return native_qag(std::forward<UnaryRealFunction_>(fn), lower, upper,
+                      config, iwork, work, ier);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Dispatches to the configured backend for validated configuration
+ *           parameters and bounds on index and working arrays of sufficient
+ *           size.
+ *
+ * \tparam   UnaryRealFunction_  A `Callable` type invocable with
+ *                               `const double` and returning `double`.
+ *
+ * \param    fn      a `UnaryRealFunction_` functor.
+ * \param    lower   a `double` for the lower bound.
+ * \param    upper   a `double` for the upper bound.
+ * \param    config  a `integratecpp::integrator::config_type`.
+ * \param    iwork   a pointer to an index array of size
+ *                   `config.max_subdivisions`.
+ * \param    work    a pointer to a working array of size `config.work_size`.
+ */
+template <typename UnaryRealFunction_>
+inline integrator::return_type qag(UnaryRealFunction_ &&fn, const double lower,
+                                   const double upper,
+                                   const integrator::config_type &config,
+                                   int *iwork, double *work) {
+    auto ier = 0;
+    const auto out = qag(std::forward<UnaryRealFunction_>(fn), lower, upper,
+                         config, iwork, work, ier);
+    throw_if_error(ier, nullptr, out);
+    return out;
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Calls the native port of `dqagp` for validated configuration
+ *           parameters, bounds, and break points on index and working arrays
+ *           of sufficient size.
+ *
+ * \tparam   UnaryRealFunction_  A `Callable` type invocable with
+ *                               `const double` and returning `double`.
+ *
+ * \param    fn      a `UnaryRealFunction_` functor.
+ * \param    lower   a `double` for the lower bound.
+ * \param    upper   a `double` for the upper bound.
+ * \param    points  a `std::vector<double>` of break points.
+ * \param    config  a `integratecpp::integrator::config_type`.
+ * \param    iwork   a pointer to an index array of size
+ *                   `2 * config.max_subdivisions + points.size() + 2`.
+ * \param    work    a pointer to a working array of size
+ *                   `config.work_size + points.size() + 2`.
+ */
+template <typename UnaryRealFunction_>
+inline integrator::return_type native_qagp(UnaryRealFunction_ &&fn,
+                                           const double lower,
+                                           const double upper,
+                                           const std::vector<double> &points,
+                                           const integrator::config_type &config,
+                                           int *iwork, double *work) {
+    using return_type = integrator::return_type;
+    using integrand_type = guarded_integrand<
+        typename std::remove_reference<UnaryRealFunction_>::type>;
+
+    auto out = return_type{};  // NOTE: construct returned object
+    auto ier = 0;
+
+    const auto npts2 = static_cast<int>(points.size()) + 2;
+
+    // NOTE: exceptions during function evaluations propagate directly
+    auto integrand = integrand_type{fn};
+    quadpack::qagp(integrand, lower, upper, npts2, points.data(),
+                   config.absolute_accuracy, config.relative_accuracy,
+                   out.value, out.absolute_error, out.neval, ier,
+                   config.max_subdivisions, config.work_size + npts2,
+                   out.subdivisions, iwork, work);
+
+    throw_if_error(ier, nullptr, out);
+
+    return out;
+}
+
+/*!
+ * \internal
+ *
+ * \brief    A pool of threads distributing the indices of a loop by work
+ *           stealing.
+ *
+ * Each worker starts with a contiguous range of indices and processes it from
+ * the front. An idle worker steals the back half of the remaining range of
+ * another worker, i.e., items of varying cost are balanced without a shared
+ * queue. The calling thread participates as worker `0`.
+ */
+class work_stealing_pool {
+   private:
+    //! \internal
+    //! \brief The remaining range of indices of a worker.
+    struct range_type {
+        std::mutex mutex{};
+        std::size_t begin{0};
+        std::size_t end{0};
+    };
+
+    std::vector<std::thread> threads_{};
+    std::unique_ptr<range_type[]> ranges_;
+    int size_;
+
+    std::mutex mutex_{};
+    std::condition_variable start_{};
+    std::condition_variable done_{};
+    std::function<void(int, std::size_t)> task_{};
+    std::exception_ptr e_ptr_{};
+    std::size_t generation_{0};
+    int running_{0};
+    bool stop_{false};
+
+    bool pop(const int worker, std::size_t &index) {
+        auto &range = ranges_[worker];
+        std::lock_guard<std::mutex> lock{range.mutex};
+        if (range.begin == range.end) {
+            return false;
+        }
+        index = range.begin++;
+        return true;
+    }
+
+    bool steal(const int worker, std::size_t &index) {
+        for (auto k = 1; k < size_; ++k) {
+            auto &victim = ranges_[(worker + k) % size_];
+            std::size_t begin, end;
+            {
+                std::lock_guard<std::mutex> lock{victim.mutex};
+                if (victim.begin == victim.end) {
+                    continue;
+                }
+                end = victim.end;
+                begin = end - (end - victim.begin + 1) / 2;
+                victim.end = begin;
+            }
+            // NOTE: the own range is empty, i.e., no other worker steals from
+            // it in the meantime.
+            auto &range = ranges_[worker];
+            std::lock_guard<std::mutex> lock{range.mutex};
+            index = begin;
+            range.begin = begin + 1;
+            range.end = end;
+            return true;
+        }
+        return false;
+    }
+
+    void work(const int worker) {
+        try {
+            auto index = std::size_t{0};
+            while (pop(worker, index) || steal(worker, index)) {
+                task_(worker, index);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!e_ptr_) {
+                e_ptr_ = std::current_exception();
+            }
+        }
+    }
+
+    void loop(const int worker) {
+        auto generation = std::size_t{0};
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                start_.wait(lock, [&] {
+                    return stop_ || generation_ != generation;
+                });
+                if (stop_) {
+                    return;
+                }
+                generation = generation_;
+            }
+            work(worker);
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (--running_ == 0) {
+                    done_.notify_one();
+                }
+            }
+        }
+    }
+
+   public:
+    /*!
+     * \internal
+     *
+     * \brief  Starts `thread_count - 1` threads.
+     *
+     * \param thread_count  an `int` for the number of workers including the
+     *                      calling thread; at least `1`.
+     */
+    explicit work_stealing_pool(const int thread_count)
+        : ranges_{new range_type[std::max(1, thread_count)]},
+          size_{std::max(1, thread_count)} {
+        threads_.reserve(size_ - 1);
+        for (auto worker = 1; worker < size_; ++worker) {
+            threads_.emplace_back([this, worker] { loop(worker); });
+        }
+    }
+
+    work_stealing_pool(const work_stealing_pool &) = delete;
+    work_stealing_pool &operator=(const work_stealing_pool &) = delete;
+
+    ~work_stealing_pool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+
+    //! \internal
+    //! \brief The number of workers including the calling thread.
+    int size() const noexcept { return size_; }
+
+    /*!
+     * \internal
+     *
+     * \brief  Calls `task(worker, index)` for all `index` in `[0, n)` and
+     *         blocks until all calls returned.
+     *
+     * \param n     a `std::size_t` for the number of indices.
+     * \param task  a `Callable` invocable with `int` for the worker in
+     *              `[0, size())` and `std::size_t` for the index.
+     *
+     * \exception  rethrows the first exception thrown by `task`; the
+     *             remaining indices of the throwing worker are skipped.
+     */
+    template <typename Task_>
+    void parallel_for(const std::size_t n, Task_ &&task) {
+        for (auto worker = 0; worker < size_; ++worker) {
+            ranges_[worker].begin = n * worker / size_;
+            ranges_[worker].end = n * (worker + 1) / size_;
+        }
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            task_ = std::forward<Task_>(task);
+            e_ptr_ = nullptr;
+            running_ = size_ - 1;
+            ++generation_;
+        }
+        start_.notify_all();
+        work(0);
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            done_.wait(lock, [this] { return running_ == 0; });
+            task_ = nullptr;
+        }
+        if (e_ptr_) {
+            std::rethrow_exception(e_ptr_);
+        }
+    }
+};
+
+/*!
+ * \internal
+ *
+ * \brief    Determines the number of threads for a requested number of
+ *           threads and a number of independent tasks.
+ *
+ * \param    thread_count  an `int` for the requested number of threads;
+ *                         `0` for `std::thread::hardware_concurrency()`.
+ * \param    n             a `std::size_t` for the number of tasks.
+ *
+ * \return   an `int` for the number of threads in `[1, max(1, n)]`.
+ *
+ * \exception  throws integratecpp::invalid_input_error if `thread_count` is
+ *             negative.
+ */
+inline int resolve_thread_count(const int thread_count, const std::size_t n) {
+    if (thread_count < 0) {
+        throw invalid_input_error("the input is invalid");
+    }
+
+    // NOTE: `std::thread::hardware_concurrency()` may return zero if the
+    // value is not computable.
+    auto size = thread_count > 0
+                    ? thread_count
+                    : static_cast<int>(std::thread::hardware_concurrency());
+    if (static_cast<std::size_t>(size) > n) {
+        size = static_cast<int>(n);
+    }
+    return std::max(1, size);
+}
+
+/*!
+ * \internal
+ *
+ * \brief    Calls `integratecpp::quadpack::qage_parallel` with the rules of
+ *           `Rdqags` or `Rdqagi` for validated configuration parameters and
+ *           bounds on index and working arrays of sufficient size.
+ *
+ * \tparam   UnaryRealFunction_  A `Callable` type invocable with
+ *                               `const double` and returning `double`.
+ *
+ * \param    fn       a `UnaryRealFunction_` functor.
+ * \param    lower    a `double` for the lower bound.
+ * \param    upper    a `double` for the upper bound.
+ * \param    config   a `integratecpp::integrator::config_type`.
+ * \param    iwork    a pointer to an index array of size
+ *                    `config.max_subdivisions`.
+ * \param    work     a pointer to a working array of size `config.work_size`.
+ * \param    pool     a `integratecpp::detail::work_stealing_pool`.
+ * \param    nbisect  an `int` for the number of subintervals bisected at
+ *                    once.
+ */
+template <typename UnaryRealFunction_>
+inline integrator::return_type parallel_qag(
+    UnaryRealFunction_ &&fn, const double lower, const double upper,
+    const integrator::config_type &config, int *iwork, double *work,
+    work_stealing_pool &pool, const int nbisect) {
+    using return_type = integrator::return_type;
+    using integrand_type = guarded_integrand<
+        typename std::remove_reference<UnaryRealFunction_>::type>;
+
+    auto out = return_type{};  // NOTE: construct returned object
+    auto ier = 0;
+
+    const auto limit = config.max_subdivisions;
+
+    auto integrand = integrand_type{fn};
+    if (std::isfinite(lower) && std::isfinite(upper)) {
+        const auto rule = quadpack::qk21_rule<integrand_type>{integrand};
+        quadpack::qage_parallel(
+            rule, pool, lower, upper, config.absolute_accuracy,
+            config.relative_accuracy, limit, nbisect, out.value,
+            out.absolute_error, out.neval, ier, &work[0], &work[limit],
+            &work[2 * limit], &work[3 * limit], iwork, out.subdivisions);
+    } else {
+        const auto bounds_info = translate_bounds(lower, upper);
+        const auto inf = bounds_info.second;
+        const auto rule = quadpack::qk15i_rule<integrand_type>{
+            integrand, inf == 2 ? 0. : bounds_info.first, inf};
+        quadpack::qage_parallel(
+            rule, pool, 0., 1., config.absolute_accuracy,
+            config.relative_accuracy, limit, nbisect, out.value,
+            out.absolute_error, out.neval, ier, &work[0], &work[limit],
+            &work[2 * limit], &work[3 * limit], iwork, out.subdivisions);
+    }
+
+    throw_if_error(ier, nullptr, out);
+
+    return out;
+}
+
+}  // namespace detail
+//! \endcond
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::integrator::operator()(...)
+// -----------------------------------------------------------------------------
+
+template <typename UnaryRealFunction_>
+inline integrator::return_type integrator::operator()(
+    UnaryRealFunction_ &&fn, const double lower, const double upper) const {
+    // NOTE: the empty workspace is only allocated after the configuration
+    // parameters have been validated.
+    auto workspace = workspace_type{};
+    return (*this)(std::forward<UnaryRealFunction_>(fn), lower, upper,
+                   workspace);
+}
+
+template <typename UnaryRealFunction_>
+inline integrator::return_type integrator::operator()(
+    UnaryRealFunction_ &&fn, const double lower, const double upper,
+    workspace_type &workspace) const {
+    static_assert(
+        type_traits::is_integrand<
+            typename std::remove_reference<UnaryRealFunction_>::type>::value,
+        "`UnaryRealFunction_` is neither invocable with `const double` and "
+        "return value `double` nor with `const double *`, `double *`, and "
+        "`int`");
+
+    detail::throw_if_invalid_config(config_);
+    detail::throw_if_invalid_bounds(lower, upper);
+
+    // NOTE: ensure sufficient capacities of working array and index array
+    workspace.reserve(config_);
+
+    return detail::qag(std::forward<UnaryRealFunction_>(fn), lower, upper,
+                       config_, workspace.iwork(), workspace.work());
+}
+
+template <typename UnaryRealFunction_>
+inline integrator::return_type integrator::operator()(
+    UnaryRealFunction_ &&fn, const double lower, const double upper,
+    const std::vector<double> &points) const {
+    // NOTE: the empty workspace is only allocated after the configuration
+    // parameters have been validated.
+    auto workspace = workspace_type{};
+    return (*this)(std::forward<UnaryRealFunction_>(fn), lower, upper, points,
+                   workspace);
+}
+
+template <typename UnaryRealFunction_>
+inline integrator::return_type integrator::operator()(
+    UnaryRealFunction_ &&fn, const double lower, const double upper,
+    const std::vector<double> &points, workspace_type &workspace) const {
+    static_assert(
+        type_traits::is_integrand<
+            typename std::remove_reference<UnaryRealFunction_>::type>::value,
+        "`UnaryRealFunction_` is neither invocable with `const double` and "
+        "return value `double` nor with `const double *`, `double *`, and "
+        "`int`");
+
+    if (points.empty()) {
+        return (*this)(std::forward<UnaryRealFunction_>(fn), lower, upper,
+                       workspace);
+    }
+
+    detail::throw_if_invalid_config(config_);
+    detail::throw_if_invalid_bounds(lower, upper);
+    detail::throw_if_invalid_points(lower, upper, points, config_);
+
+    // NOTE: `dqagp` additionally requires the levels of the subintervals,
+    // the sorted break points, and a flag per initial subinterval.
+    const auto npts2 = static_cast<int>(points.size()) + 2;
+    auto capacities = config_;
+    capacities.max_subdivisions = 2 * config_.max_subdivisions + npts2;
+    capacities.work_size = config_.work_size + npts2;
+    workspace.reserve(capacities);
+
+    return detail::native_qagp(std::forward<UnaryRealFunction_>(fn), lower,
+                               upper, points, config_, workspace.iwork(),
+                               workspace.work());
+}
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::integrator::try_integrate(...)
+// -----------------------------------------------------------------------------
+
+template <typename UnaryRealFunction_>
+inline integrator::status_type
+integrator::try_integrate(UnaryRealFunction_ &&fn, const double lower,
+                          const double upper, return_type &out) const {
+    // NOTE: the empty workspace is only allocated after the configuration
+    // parameters have been validated.
+    auto workspace = workspace_type{};
+    return try_integrate(std::forward<UnaryRealFunction_>(fn), lower, upper,
+                         out, workspace);
+}
+
+template <typename UnaryRealFunction_>
+inline integrator::status_type integrator::try_integrate(
+    UnaryRealFunction_ &&fn, const double lower, const double upper,
+    return_type &out, workspace_type &workspace) const {
+    static_assert(
+        type_traits::is_integrand<
+            typename std::remove_reference<UnaryRealFunction_>::type>::value,
+        "`UnaryRealFunction_` is neither invocable with `const double` and "
+        "return value `double` nor with `const double *`, `double *`, and "
+        "`int`");
+
+    // NOTE: the validation is repeated without throwing, i.e., no exception
+    // (and message) is constructed for invalid input.
+    if (!detail::is_valid_config(config_) || std::isnan(lower) ||
+        std::isnan(upper)) {
+        out = return_type{};
+        return status_type::invalid_input;
+    }
+
+    // NOTE: ensure sufficient capacities of working array and index array
+    workspace.reserve(config_);
+
+    auto ier = 0;
+    out = detail::qag(std::forward<UnaryRealFunction_>(fn), lower, upper,
+                      config_, workspace.iwork(), workspace.work(), ier);
+    return static_cast<status_type>(ier);
+}
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::integrator::integrate_batch(...)
+// -----------------------------------------------------------------------------
+
+template <typename UnaryRealFunction_>
+inline void integrator::integrate_batch(UnaryRealFunction_ &&fn,
+                                        const double *lower,
+                                        const double *upper,
+                                        const std::size_t n, return_type *out,
+                                        status_type *status) const {
+    // NOTE: the empty workspace is only allocated after the configuration
+    // parameters have been validated.
+    auto workspace = workspace_type{};
+    integrate_batch(std::forward<UnaryRealFunction_>(fn), lower, upper, n, out,
+                    status, workspace);
+}
+
+template <typename UnaryRealFunction_>
+inline void integrator::integrate_batch(UnaryRealFunction_ &&fn,
+                                        const double *lower,
+                                        const double *upper,
+                                        const std::size_t n, return_type *out,
+                                        status_type *status,
+                                        workspace_type &workspace) const {
+    static_assert(
+        type_traits::is_integrand<
+            typename std::remove_reference<UnaryRealFunction_>::type>::value,
+        "`UnaryRealFunction_` is neither invocable with `const double` and "
+        "return value `double` nor with `const double *`, `double *`, and "
+        "`int`");
+
+    detail::throw_if_invalid_config(config_);
+
+    // NOTE: ensure sufficient capacities of working array and index array
+    workspace.reserve(config_);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        if (std::isnan(lower[i]) || std::isnan(upper[i])) {
+            out[i] = return_type{};
+            status[i] = status_type::invalid_input;
+            continue;
+        }
+        auto ier = 0;
+        // NOTE: `fn` is not forwarded as it is used for all items.
+        out[i] = detail::qag(fn, lower[i], upper[i], config_, workspace.iwork(),
+                             workspace.work(), ier);
+        status[i] = static_cast<status_type>(ier);
+    }
+}
+
+template <typename UnaryRealFunction_>
+inline void integrator::integrate_batch(
+    UnaryRealFunction_ &&fn, const std::vector<double> &lower,
+    const std::vector<double> &upper, std::vector<return_type> &out,
+    std::vector<status_type> &status) const {
+    if (lower.size() != upper.size()) {
+        throw invalid_input_error("the input is invalid");
+    }
+    out.resize(lower.size());
+    status.resize(lower.size());
+    integrate_batch(std::forward<UnaryRealFunction_>(fn), lower.data(),
+                    upper.data(), lower.size(), out.data(), status.data());
+}
+
+template <typename UnaryRealFunction_>
+inline void integrator::integrate_batch_parallel(
+    UnaryRealFunction_ &&fn, const double *lower, const double *upper,
+    const std::size_t n, return_type *out, std::exception_ptr *errors,
+    const int thread_count) const {
+    static_assert(
+        type_traits::is_integrand<
+            typename std::remove_reference<UnaryRealFunction_>::type>::value,
+        "`UnaryRealFunction_` is neither invocable with `const double` and "
+        "return value `double` nor with `const double *`, `double *`, and "
+        "`int`");
+
+    detail::throw_if_invalid_config(config_);
+    const auto size = detail::resolve_thread_count(thread_count, n);
+
+    auto workspaces = std::vector<workspace_type>(size);
+    for (auto &workspace : workspaces) {
+        workspace.reserve(config_);
+    }
+
+    detail::work_stealing_pool pool{size};
+    pool.parallel_for(n, [&](const int worker, const std::size_t i) {
+        out[i] = return_type{};
+        if (std::isnan(lower[i]) || std::isnan(upper[i])) {
+            errors[i] = std::make_exception_ptr(
+                invalid_input_error("the input is invalid"));
+            return;
+        }
+        auto &workspace = workspaces[worker];
+        try {
+            auto ier = 0;
+            out[i] = detail::qag(fn, lower[i], upper[i], config_,
+                                 workspace.iwork(), workspace.work(), ier);
+            errors[i] = detail::make_error(ier, out[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+}
+
+template <typename UnaryRealFunction_>
+inline void integrator::integrate_batch_parallel(
+    UnaryRealFunction_ &&fn, const std::vector<double> &lower,
+    const std::vector<double> &upper, std::vector<return_type> &out,
+    std::vector<std::exception_ptr> &errors, const int thread_count) const {
+    if (lower.size() != upper.size()) {
+        throw invalid_input_error("the input is invalid");
+    }
+    out.resize(lower.size());
+    errors.resize(lower.size());
+    integrate_batch_parallel(std::forward<UnaryRealFunction_>(fn),
+                             lower.data(), upper.data(), lower.size(),
+                             out.data(), errors.data(), thread_count);
+}
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::integrator::integrate_parallel(...)
+// -----------------------------------------------------------------------------
+
+template <typename UnaryRealFunction_>
+inline integrator::return_type integrator::integrate_parallel(
+    UnaryRealFunction_ &&fn, const double lower, const double upper,
+    const int thread_count, const int bisections) const {
+    static_assert(
+        type_traits::is_integrand<
+            typename std::remove_reference<UnaryRealFunction_>::type>::value,
+        "`UnaryRealFunction_` is neither invocable with `const double` and "
+        "return value `double` nor with `const double *`, `double *`, and "
+        "`int`");
+
+    detail::throw_if_invalid_config(config_);
+    detail::throw_if_invalid_bounds(lower, upper);
+    if (bisections < 1) {
+        throw invalid_input_error("the input is invalid");
+    }
+    // NOTE: a round applies the rule to at most `2 * bisections` subintervals.
+    const auto size = detail::resolve_thread_count(
+        thread_count, 2 * static_cast<std::size_t>(bisections));
+
+    auto workspace = workspace_type{config_};
+    detail::work_stealing_pool pool{size};
+    return detail::parallel_qag(std::forward<UnaryRealFunction_>(fn), lower,
+                                upper, config_, workspace.iwork(),
+                                workspace.work(), pool, bisections);
+}
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::integrate::(...)
+// -----------------------------------------------------------------------------
+
+template <typename UnaryRealFunction_>
+inline integrator::return_type integrate(UnaryRealFunction_ &&fn,
+                                         const double lower, const double upper,
+                                         const integrator::config_type config) {
+    return integrator{config}(std::forward<UnaryRealFunction_>(fn), lower,
+                              upper);
+}
+
+template <typename UnaryRealFunction_>
+inline integrator::return_type integrate(UnaryRealFunction_ &&fn,
+                                         const double lower, const double upper,
+                                         const integrator::config_type &config,
+                                         integrator::workspace_type &workspace) {
+    return integrator{config}(std::forward<UnaryRealFunction_>(fn), lower,
+                              upper, workspace);
+}
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::static_integrator
+// -----------------------------------------------------------------------------
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline static_integrator<MaxSubdivisions_, WorkSize_>::static_integrator(
+    const double relative_accuracy)
+    : static_integrator{relative_accuracy, relative_accuracy} {}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline static_integrator<MaxSubdivisions_, WorkSize_>::static_integrator(
+    const double relative_accuracy, const double absolute_accuracy)
+    : relative_accuracy_{relative_accuracy},
+      absolute_accuracy_{absolute_accuracy} {
+    detail::throw_if_invalid_config(config());
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline static_integrator<MaxSubdivisions_, WorkSize_>::static_integrator(
+    const double relative_accuracy, const double absolute_accuracy,
+    const backend_type backend)
+    : relative_accuracy_{relative_accuracy},
+      absolute_accuracy_{absolute_accuracy},
+      backend_{backend} {
+    detail::throw_if_invalid_config(config());
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline static_integrator<MaxSubdivisions_, WorkSize_>::static_integrator(
+    const double relative_accuracy, const double absolute_accuracy,
+    const backend_type backend, const int rule_points)
+    : relative_accuracy_{relative_accuracy},
+      absolute_accuracy_{absolute_accuracy},
+      backend_{backend},
+      rule_points_{rule_points} {
+    detail::throw_if_invalid_config(config());
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline constexpr auto static_integrator<MaxSubdivisions_, WorkSize_>::config()
+    const noexcept -> config_type {
+    return config_type{MaxSubdivisions_, relative_accuracy_,
+                       absolute_accuracy_, WorkSize_, backend_, rule_points_};
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline constexpr int
+static_integrator<MaxSubdivisions_, WorkSize_>::max_subdivisions() noexcept {
+    return MaxSubdivisions_;
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline constexpr double
+static_integrator<MaxSubdivisions_, WorkSize_>::relative_accuracy()
+    const noexcept {
+    return relative_accuracy_;
+}
+template <int MaxSubdivisions_, int WorkSize_>
+inline void static_integrator<MaxSubdivisions_, WorkSize_>::relative_accuracy(
+    const double relative_accuracy) {
+    *this = static_integrator{relative_accuracy, absolute_accuracy_, backend_,
+                              rule_points_};
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline constexpr double
+static_integrator<MaxSubdivisions_, WorkSize_>::absolute_accuracy()
+    const noexcept {
+    return absolute_accuracy_;
+}
+template <int MaxSubdivisions_, int WorkSize_>
+inline void static_integrator<MaxSubdivisions_, WorkSize_>::absolute_accuracy(
+    const double absolute_accuracy) {
+    *this = static_integrator{relative_accuracy_, absolute_accuracy, backend_,
+                              rule_points_};
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline constexpr int
+static_integrator<MaxSubdivisions_, WorkSize_>::work_size() noexcept {
+    return WorkSize_;
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline constexpr auto static_integrator<MaxSubdivisions_, WorkSize_>::backend()
+    const noexcept -> backend_type {
+    return backend_;
+}
+template <int MaxSubdivisions_, int WorkSize_>
+inline void static_integrator<MaxSubdivisions_, WorkSize_>::backend(
+    const backend_type backend) {
+    *this = static_integrator{relative_accuracy_, absolute_accuracy_, backend,
+                              rule_points_};
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+inline constexpr int
+static_integrator<MaxSubdivisions_, WorkSize_>::rule_points() const noexcept {
+    return rule_points_;
+}
+template <int MaxSubdivisions_, int WorkSize_>
+inline void static_integrator<MaxSubdivisions_, WorkSize_>::rule_points(
+    const int rule_points) {
+    *this = static_integrator{relative_accuracy_, absolute_accuracy_, backend_,
+                              rule_points};
+}
+
+template <int MaxSubdivisions_, int WorkSize_>
+template <typename UnaryRealFunction_>
+inline auto static_integrator<MaxSubdivisions_, WorkSize_>::operator()(
+    UnaryRealFunction_ &&fn, const double lower, const double upper) const
+    -> return_type {
+    static_assert(
+        type_traits::is_integrand<
+            typename std::remove_reference<UnaryRealFunction_>::type>::value,
+        "`UnaryRealFunction_` is neither invocable with `const double` and "
+        "return value `double` nor with `const double *`, `double *`, and "
+        "`int`");
+
+    // NOTE: the configuration parameters are validated upon construction and
+    // setting of `integratecpp::static_integrator`.
+    detail::throw_if_invalid_bounds(lower, upper);
+
+    // NOTE: `Rdqag[is]` initialize all used entries, i.e., the arrays are not
+    // value-initialized.
+    std::array<int, MaxSubdivisions_> iwork;
+    std::array<double, WorkSize_> work;
+
+    return detail::qag(std::forward<UnaryRealFunction_>(fn), lower, upper,
+                       config(), iwork.data(), work.data());
+}
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::integrator::return_type
+// -----------------------------------------------------------------------------
+
+inline constexpr integrator::return_type::return_type(
+    const double value, const double absolute_error, const int subdivisions,
+    const int neval) noexcept
+    : value{value},
+      absolute_error{absolute_error},
+      subdivisions{subdivisions},
+      neval{neval} {}
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::integrator::config_type
+// -----------------------------------------------------------------------------
+
+inline constexpr integrator::config_type::config_type(
+    const int max_subdivisions, const double relative_accuracy) noexcept
+    : config_type{max_subdivisions, relative_accuracy, relative_accuracy,
+                  4 * max_subdivisions} {}
+
+inline constexpr integrator::config_type::config_type(
+    const int max_subdivisions, const double relative_accuracy,
+    const double absolute_accuracy) noexcept
+    : config_type{max_subdivisions, relative_accuracy, absolute_accuracy,
+                  4 * max_subdivisions} {}
+
+inline constexpr integrator::config_type::config_type(
+    const int max_subdivisions, const double relative_accuracy,
+    const double absolute_accuracy, const int work_size) noexcept
+    : max_subdivisions{max_subdivisions},
+      relative_accuracy{relative_accuracy},
+      absolute_accuracy{absolute_accuracy},
+      work_size{work_size} {}
+
+inline constexpr integrator::config_type::config_type(
+    const int max_subdivisions, const double relative_accuracy,
+    const double absolute_accuracy, const int work_size,
+    const backend_type backend) noexcept
+    : max_subdivisions{max_subdivisions},
+      relative_accuracy{relative_accuracy},
+      absolute_accuracy{absolute_accuracy},
+      work_size{work_size},
+      backend{backend} {}
+
+inline constexpr integrator::config_type::config_type(
+    const int max_subdivisions, const double relative_accuracy,
+    const double absolute_accuracy, const int work_size,
+    const backend_type backend, const int rule_points) noexcept
+    : max_subdivisions{max_subdivisions},
+      relative_accuracy{relative_accuracy},
+      absolute_accuracy{absolute_accuracy},
+      work_size{work_size},
+      backend{backend},
+      rule_points{rule_points} {}
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::integrator::workspace_type
+// -----------------------------------------------------------------------------
+
+inline integrator::workspace_type::workspace_type(const config_type &config) {
+    reserve(config);
+}
+
+inline void integrator::workspace_type::reserve(const config_type &config) {
+    // NOTE: non-positive sizes are ignored; they are reported as invalid input
+    // by `integratecpp::integrator::operator()()`.
+    if (config.max_subdivisions > 0 &&
+        iwork_.size() < static_cast<std::size_t>(config.max_subdivisions)) {
+        iwork_.resize(static_cast<std::size_t>(config.max_subdivisions));
+    }
+    if (config.work_size > 0 &&
+        work_.size() < static_cast<std::size_t>(config.work_size)) {
+        work_.resize(static_cast<std::size_t>(config.work_size));
+    }
+}
+
+inline int integrator::workspace_type::max_subdivisions() const noexcept {
+    return static_cast<int>(iwork_.size());
+}
+
+inline int integrator::workspace_type::work_size() const noexcept {
+    return static_cast<int>(work_.size());
+}
+
+inline int *integrator::workspace_type::iwork() noexcept {
+    return iwork_.data();
+}
+
+inline double *integrator::workspace_type::work() noexcept {
+    return work_.data();
+}
+
+// -----------------------------------------------------------------------------
+// Implementations of integratecpp::integrator
+// -----------------------------------------------------------------------------
 
 inline constexpr integrator::integrator(const config_type &config) noexcept
     : config_{config} {}
@@ -1010,6 +6109,22 @@ inline void integrator::work_size(const int work_size) noexcept {
     config_.work_size = work_size;
 }
 
+inline constexpr auto integrator::backend() const noexcept
+    -> decltype(config_.backend) {
+    return config_.backend;
+}
+inline void integrator::backend(const backend_type backend) noexcept {
+    config_.backend = backend;
+}
+
+inline constexpr auto integrator::rule_points() const noexcept
+    -> decltype(config_.rule_points) {
+    return config_.rule_points;
+}
+inline void integrator::rule_points(const int rule_points) noexcept {
+    config_.rule_points = rule_points;
+}
+
 // -----------------------------------------------------------------------------
 // Implementations of exception classes
 // -----------------------------------------------------------------------------
@@ -91,32 +91,150 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// Rcpp__compiled_integrand__dnorm
+SEXP Rcpp__compiled_integrand__dnorm(const bool vectorized);
+RcppExport SEXP _integratecpp_Rcpp__compiled_integrand__dnorm(SEXP vectorizedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__compiled_integrand__dnorm(vectorized));
+    return rcpp_result_gen;
+END_RCPP
+}
 // Rcpp__integrate
-Rcpp::List Rcpp__integrate(Rcpp::Function fn, const double lower, const double upper, const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size);
-RcppExport SEXP _integratecpp_Rcpp__integrate(SEXP fnSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP) {
+Rcpp::List Rcpp__integrate(Rcpp::Function fn, const double lower, const double upper, const std::vector<double> points, const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size, const std::string backend, const int rule_points, const bool vectorized);
+RcppExport SEXP _integratecpp_Rcpp__integrate(SEXP fnSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP pointsSEXP, SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP, SEXP backendSEXP, SEXP rule_pointsSEXP, SEXP vectorizedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::Function >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< const double >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const double >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double> >::type points(pointsSEXP);
+    Rcpp::traits::input_parameter< const int >::type max_subdivisions(max_subdivisionsSEXP);
+    Rcpp::traits::input_parameter< const double >::type relative_accuracy(relative_accuracySEXP);
+    Rcpp::traits::input_parameter< const double >::type absolute_accuracy(absolute_accuracySEXP);
+    Rcpp::traits::input_parameter< const int >::type work_size(work_sizeSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type backend(backendSEXP);
+    Rcpp::traits::input_parameter< const int >::type rule_points(rule_pointsSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrate(fn, lower, upper, points, max_subdivisions, relative_accuracy, absolute_accuracy, work_size, backend, rule_points, vectorized));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrate_compiled
+Rcpp::List Rcpp__integrate_compiled(SEXP fn, SEXP params, const double lower, const double upper, const std::vector<double> points, const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size, const std::string backend, const int rule_points, const bool vectorized);
+RcppExport SEXP _integratecpp_Rcpp__integrate_compiled(SEXP fnSEXP, SEXP paramsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP pointsSEXP, SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP, SEXP backendSEXP, SEXP rule_pointsSEXP, SEXP vectorizedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const double >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const double >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double> >::type points(pointsSEXP);
+    Rcpp::traits::input_parameter< const int >::type max_subdivisions(max_subdivisionsSEXP);
+    Rcpp::traits::input_parameter< const double >::type relative_accuracy(relative_accuracySEXP);
+    Rcpp::traits::input_parameter< const double >::type absolute_accuracy(absolute_accuracySEXP);
+    Rcpp::traits::input_parameter< const int >::type work_size(work_sizeSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type backend(backendSEXP);
+    Rcpp::traits::input_parameter< const int >::type rule_points(rule_pointsSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrate_compiled(fn, params, lower, upper, points, max_subdivisions, relative_accuracy, absolute_accuracy, work_size, backend, rule_points, vectorized));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrate_many
+Rcpp::List Rcpp__integrate_many(Rcpp::Function fn, const Rcpp::NumericVector lower, const Rcpp::NumericVector upper, const Rcpp::List args, const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size, const std::string backend, const int rule_points, const bool vectorized);
+RcppExport SEXP _integratecpp_Rcpp__integrate_many(SEXP fnSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP argsSEXP, SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP, SEXP backendSEXP, SEXP rule_pointsSEXP, SEXP vectorizedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< Rcpp::Function >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List >::type args(argsSEXP);
+    Rcpp::traits::input_parameter< const int >::type max_subdivisions(max_subdivisionsSEXP);
+    Rcpp::traits::input_parameter< const double >::type relative_accuracy(relative_accuracySEXP);
+    Rcpp::traits::input_parameter< const double >::type absolute_accuracy(absolute_accuracySEXP);
+    Rcpp::traits::input_parameter< const int >::type work_size(work_sizeSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type backend(backendSEXP);
+    Rcpp::traits::input_parameter< const int >::type rule_points(rule_pointsSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrate_many(fn, lower, upper, args, max_subdivisions, relative_accuracy, absolute_accuracy, work_size, backend, rule_points, vectorized));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrate_many_compiled
+Rcpp::List Rcpp__integrate_many_compiled(SEXP fn, SEXP params, const Rcpp::NumericVector lower, const Rcpp::NumericVector upper, const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size, const std::string backend, const int rule_points, const bool vectorized, const int thread_count);
+RcppExport SEXP _integratecpp_Rcpp__integrate_many_compiled(SEXP fnSEXP, SEXP paramsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP, SEXP backendSEXP, SEXP rule_pointsSEXP, SEXP vectorizedSEXP, SEXP thread_countSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const int >::type max_subdivisions(max_subdivisionsSEXP);
+    Rcpp::traits::input_parameter< const double >::type relative_accuracy(relative_accuracySEXP);
+    Rcpp::traits::input_parameter< const double >::type absolute_accuracy(absolute_accuracySEXP);
+    Rcpp::traits::input_parameter< const int >::type work_size(work_sizeSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type backend(backendSEXP);
+    Rcpp::traits::input_parameter< const int >::type rule_points(rule_pointsSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    Rcpp::traits::input_parameter< const int >::type thread_count(thread_countSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrate_many_compiled(fn, params, lower, upper, max_subdivisions, relative_accuracy, absolute_accuracy, work_size, backend, rule_points, vectorized, thread_count));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrate_parallel_compiled
+Rcpp::List Rcpp__integrate_parallel_compiled(SEXP fn, SEXP params, const double lower, const double upper, const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size, const bool vectorized, const int thread_count, const int bisections);
+RcppExport SEXP _integratecpp_Rcpp__integrate_parallel_compiled(SEXP fnSEXP, SEXP paramsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP, SEXP vectorizedSEXP, SEXP thread_countSEXP, SEXP bisectionsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const double >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const double >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const int >::type max_subdivisions(max_subdivisionsSEXP);
+    Rcpp::traits::input_parameter< const double >::type relative_accuracy(relative_accuracySEXP);
+    Rcpp::traits::input_parameter< const double >::type absolute_accuracy(absolute_accuracySEXP);
+    Rcpp::traits::input_parameter< const int >::type work_size(work_sizeSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    Rcpp::traits::input_parameter< const int >::type thread_count(thread_countSEXP);
+    Rcpp::traits::input_parameter< const int >::type bisections(bisectionsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrate_parallel_compiled(fn, params, lower, upper, max_subdivisions, relative_accuracy, absolute_accuracy, work_size, vectorized, thread_count, bisections));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrate_expression
+Rcpp::List Rcpp__integrate_expression(const std::vector<int> code, const std::vector<double> constants, const double lower, const double upper, const std::vector<double> points, const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size, const std::string backend, const int rule_points);
+RcppExport SEXP _integratecpp_Rcpp__integrate_expression(SEXP codeSEXP, SEXP constantsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP pointsSEXP, SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP, SEXP backendSEXP, SEXP rule_pointsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const std::vector<int> >::type code(codeSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double> >::type constants(constantsSEXP);
     Rcpp::traits::input_parameter< const double >::type lower(lowerSEXP);
     Rcpp::traits::input_parameter< const double >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double> >::type points(pointsSEXP);
     Rcpp::traits::input_parameter< const int >::type max_subdivisions(max_subdivisionsSEXP);
     Rcpp::traits::input_parameter< const double >::type relative_accuracy(relative_accuracySEXP);
     Rcpp::traits::input_parameter< const double >::type absolute_accuracy(absolute_accuracySEXP);
     Rcpp::traits::input_parameter< const int >::type work_size(work_sizeSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp__integrate(fn, lower, upper, max_subdivisions, relative_accuracy, absolute_accuracy, work_size));
+    Rcpp::traits::input_parameter< const std::string >::type backend(backendSEXP);
+    Rcpp::traits::input_parameter< const int >::type rule_points(rule_pointsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrate_expression(code, constants, lower, upper, points, max_subdivisions, relative_accuracy, absolute_accuracy, work_size, backend, rule_points));
     return rcpp_result_gen;
 END_RCPP
 }
 // Rcpp__integrator__new
-Rcpp::XPtr<integratecpp::integrator> Rcpp__integrator__new(const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size);
-RcppExport SEXP _integratecpp_Rcpp__integrator__new(SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP) {
+Rcpp::XPtr<integratecpp::integrator> Rcpp__integrator__new(const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size, const std::string backend, const int rule_points);
+RcppExport SEXP _integratecpp_Rcpp__integrator__new(SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP, SEXP backendSEXP, SEXP rule_pointsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const int >::type max_subdivisions(max_subdivisionsSEXP);
     Rcpp::traits::input_parameter< const double >::type relative_accuracy(relative_accuracySEXP);
     Rcpp::traits::input_parameter< const double >::type absolute_accuracy(absolute_accuracySEXP);
     Rcpp::traits::input_parameter< const int >::type work_size(work_sizeSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp__integrator__new(max_subdivisions, relative_accuracy, absolute_accuracy, work_size));
+    Rcpp::traits::input_parameter< const std::string >::type backend(backendSEXP);
+    Rcpp::traits::input_parameter< const int >::type rule_points(rule_pointsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrator__new(max_subdivisions, relative_accuracy, absolute_accuracy, work_size, backend, rule_points));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -200,6 +318,46 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// Rcpp__integrator__get_backend
+std::string Rcpp__integrator__get_backend(Rcpp::XPtr<integratecpp::integrator> ptr);
+RcppExport SEXP _integratecpp_Rcpp__integrator__get_backend(SEXP ptrSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<integratecpp::integrator> >::type ptr(ptrSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrator__get_backend(ptr));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrator__set_backend
+void Rcpp__integrator__set_backend(Rcpp::XPtr<integratecpp::integrator> ptr, const std::string backend);
+RcppExport SEXP _integratecpp_Rcpp__integrator__set_backend(SEXP ptrSEXP, SEXP backendSEXP) {
+BEGIN_RCPP
+    Rcpp::traits::input_parameter< Rcpp::XPtr<integratecpp::integrator> >::type ptr(ptrSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type backend(backendSEXP);
+    Rcpp__integrator__set_backend(ptr, backend);
+    return R_NilValue;
+END_RCPP
+}
+// Rcpp__integrator__get_rule_points
+int Rcpp__integrator__get_rule_points(Rcpp::XPtr<integratecpp::integrator> ptr);
+RcppExport SEXP _integratecpp_Rcpp__integrator__get_rule_points(SEXP ptrSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<integratecpp::integrator> >::type ptr(ptrSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrator__get_rule_points(ptr));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrator__set_rule_points
+void Rcpp__integrator__set_rule_points(Rcpp::XPtr<integratecpp::integrator> ptr, const int rule_points);
+RcppExport SEXP _integratecpp_Rcpp__integrator__set_rule_points(SEXP ptrSEXP, SEXP rule_pointsSEXP) {
+BEGIN_RCPP
+    Rcpp::traits::input_parameter< Rcpp::XPtr<integratecpp::integrator> >::type ptr(ptrSEXP);
+    Rcpp::traits::input_parameter< const int >::type rule_points(rule_pointsSEXP);
+    Rcpp__integrator__set_rule_points(ptr, rule_points);
+    return R_NilValue;
+END_RCPP
+}
 // Rcpp__integrator__throw_if_invalid
 void Rcpp__integrator__throw_if_invalid(Rcpp::XPtr<integratecpp::integrator> ptr);
 RcppExport SEXP _integratecpp_Rcpp__integrator__throw_if_invalid(SEXP ptrSEXP) {
@@ -210,15 +368,133 @@ BEGIN_RCPP
 END_RCPP
 }
 // Rcpp__integrator__integrate
-Rcpp::List Rcpp__integrator__integrate(Rcpp::XPtr<integratecpp::integrator> ptr, Rcpp::Function fn, const double lower, const double upper);
-RcppExport SEXP _integratecpp_Rcpp__integrator__integrate(SEXP ptrSEXP, SEXP fnSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+Rcpp::List Rcpp__integrator__integrate(Rcpp::XPtr<integratecpp::integrator> ptr, Rcpp::Function fn, const double lower, const double upper, const bool vectorized, SEXP cache, SEXP key);
+RcppExport SEXP _integratecpp_Rcpp__integrator__integrate(SEXP ptrSEXP, SEXP fnSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP vectorizedSEXP, SEXP cacheSEXP, SEXP keySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<integratecpp::integrator> >::type ptr(ptrSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Function >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< const double >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const double >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type cache(cacheSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type key(keySEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrator__integrate(ptr, fn, lower, upper, vectorized, cache, key));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrator__integrate_compiled
+Rcpp::List Rcpp__integrator__integrate_compiled(Rcpp::XPtr<integratecpp::integrator> ptr, SEXP fn, SEXP params, const double lower, const double upper, const bool vectorized, SEXP cache, SEXP key);
+RcppExport SEXP _integratecpp_Rcpp__integrator__integrate_compiled(SEXP ptrSEXP, SEXP fnSEXP, SEXP paramsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP vectorizedSEXP, SEXP cacheSEXP, SEXP keySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<integratecpp::integrator> >::type ptr(ptrSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const double >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const double >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type cache(cacheSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type key(keySEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrator__integrate_compiled(ptr, fn, params, lower, upper, vectorized, cache, key));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrator__prepare
+SEXP Rcpp__integrator__prepare(Rcpp::XPtr<integratecpp::integrator> ptr, Rcpp::Function fn, const Rcpp::List args, const bool vectorized);
+RcppExport SEXP _integratecpp_Rcpp__integrator__prepare(SEXP ptrSEXP, SEXP fnSEXP, SEXP argsSEXP, SEXP vectorizedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< Rcpp::XPtr<integratecpp::integrator> >::type ptr(ptrSEXP);
     Rcpp::traits::input_parameter< Rcpp::Function >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List >::type args(argsSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrator__prepare(ptr, fn, args, vectorized));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrator__prepare_compiled
+SEXP Rcpp__integrator__prepare_compiled(Rcpp::XPtr<integratecpp::integrator> ptr, SEXP fn, SEXP params, const bool vectorized);
+RcppExport SEXP _integratecpp_Rcpp__integrator__prepare_compiled(SEXP ptrSEXP, SEXP fnSEXP, SEXP paramsSEXP, SEXP vectorizedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::XPtr<integratecpp::integrator> >::type ptr(ptrSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrator__prepare_compiled(ptr, fn, params, vectorized));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__prepared_integration__run
+double Rcpp__prepared_integration__run(SEXP ptr, const double lower, const double upper);
+RcppExport SEXP _integratecpp_Rcpp__prepared_integration__run(SEXP ptrSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type ptr(ptrSEXP);
     Rcpp::traits::input_parameter< const double >::type lower(lowerSEXP);
     Rcpp::traits::input_parameter< const double >::type upper(upperSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp__integrator__integrate(ptr, fn, lower, upper));
+    rcpp_result_gen = Rcpp::wrap(Rcpp__prepared_integration__run(ptr, lower, upper));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__result_cache__new
+SEXP Rcpp__result_cache__new(const int capacity);
+RcppExport SEXP _integratecpp_Rcpp__result_cache__new(SEXP capacitySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int >::type capacity(capacitySEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__result_cache__new(capacity));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__result_cache__stats
+Rcpp::List Rcpp__result_cache__stats(SEXP ptr);
+RcppExport SEXP _integratecpp_Rcpp__result_cache__stats(SEXP ptrSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type ptr(ptrSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__result_cache__stats(ptr));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrate_lazy
+SEXP Rcpp__integrate_lazy(Rcpp::Function fn, const Rcpp::List args, const Rcpp::NumericVector lower, const Rcpp::NumericVector upper, const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size, const std::string backend, const int rule_points, const bool vectorized);
+RcppExport SEXP _integratecpp_Rcpp__integrate_lazy(SEXP fnSEXP, SEXP argsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP, SEXP backendSEXP, SEXP rule_pointsSEXP, SEXP vectorizedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::Function >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::List >::type args(argsSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const int >::type max_subdivisions(max_subdivisionsSEXP);
+    Rcpp::traits::input_parameter< const double >::type relative_accuracy(relative_accuracySEXP);
+    Rcpp::traits::input_parameter< const double >::type absolute_accuracy(absolute_accuracySEXP);
+    Rcpp::traits::input_parameter< const int >::type work_size(work_sizeSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type backend(backendSEXP);
+    Rcpp::traits::input_parameter< const int >::type rule_points(rule_pointsSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrate_lazy(fn, args, lower, upper, max_subdivisions, relative_accuracy, absolute_accuracy, work_size, backend, rule_points, vectorized));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp__integrate_lazy_compiled
+SEXP Rcpp__integrate_lazy_compiled(SEXP fn, SEXP params, const Rcpp::NumericVector lower, const Rcpp::NumericVector upper, const int max_subdivisions, const double relative_accuracy, const double absolute_accuracy, const int work_size, const std::string backend, const int rule_points, const bool vectorized);
+RcppExport SEXP _integratecpp_Rcpp__integrate_lazy_compiled(SEXP fnSEXP, SEXP paramsSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP max_subdivisionsSEXP, SEXP relative_accuracySEXP, SEXP absolute_accuracySEXP, SEXP work_sizeSEXP, SEXP backendSEXP, SEXP rule_pointsSEXP, SEXP vectorizedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type fn(fnSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type params(paramsSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const int >::type max_subdivisions(max_subdivisionsSEXP);
+    Rcpp::traits::input_parameter< const double >::type relative_accuracy(relative_accuracySEXP);
+    Rcpp::traits::input_parameter< const double >::type absolute_accuracy(absolute_accuracySEXP);
+    Rcpp::traits::input_parameter< const int >::type work_size(work_sizeSEXP);
+    Rcpp::traits::input_parameter< const std::string >::type backend(backendSEXP);
+    Rcpp::traits::input_parameter< const int >::type rule_points(rule_pointsSEXP);
+    Rcpp::traits::input_parameter< const bool >::type vectorized(vectorizedSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp__integrate_lazy_compiled(fn, params, lower, upper, max_subdivisions, relative_accuracy, absolute_accuracy, work_size, backend, rule_points, vectorized));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -232,8 +508,14 @@ static const R_CallMethodDef CallEntries[] = {
     {"_integratecpp_Rcpp__extrapolation_roundoff_error__catch_what", (DL_FUNC) &_integratecpp_Rcpp__extrapolation_roundoff_error__catch_what, 1},
     {"_integratecpp_Rcpp__divergence_error__catch_what", (DL_FUNC) &_integratecpp_Rcpp__divergence_error__catch_what, 1},
     {"_integratecpp_Rcpp__invalid_input_error__catch_what", (DL_FUNC) &_integratecpp_Rcpp__invalid_input_error__catch_what, 1},
-    {"_integratecpp_Rcpp__integrate", (DL_FUNC) &_integratecpp_Rcpp__integrate, 7},
-    {"_integratecpp_Rcpp__integrator__new", (DL_FUNC) &_integratecpp_Rcpp__integrator__new, 4},
+    {"_integratecpp_Rcpp__compiled_integrand__dnorm", (DL_FUNC) &_integratecpp_Rcpp__compiled_integrand__dnorm, 1},
+    {"_integratecpp_Rcpp__integrate", (DL_FUNC) &_integratecpp_Rcpp__integrate, 11},
+    {"_integratecpp_Rcpp__integrate_compiled", (DL_FUNC) &_integratecpp_Rcpp__integrate_compiled, 12},
+    {"_integratecpp_Rcpp__integrate_many", (DL_FUNC) &_integratecpp_Rcpp__integrate_many, 11},
+    {"_integratecpp_Rcpp__integrate_many_compiled", (DL_FUNC) &_integratecpp_Rcpp__integrate_many_compiled, 12},
+    {"_integratecpp_Rcpp__integrate_parallel_compiled", (DL_FUNC) &_integratecpp_Rcpp__integrate_parallel_compiled, 11},
+    {"_integratecpp_Rcpp__integrate_expression", (DL_FUNC) &_integratecpp_Rcpp__integrate_expression, 11},
+    {"_integratecpp_Rcpp__integrator__new", (DL_FUNC) &_integratecpp_Rcpp__integrator__new, 6},
     {"_integratecpp_Rcpp__integrator__get_max_subdivisions", (DL_FUNC) &_integratecpp_Rcpp__integrator__get_max_subdivisions, 1},
     {"_integratecpp_Rcpp__integrator__set_max_subdivisions", (DL_FUNC) &_integratecpp_Rcpp__integrator__set_max_subdivisions, 2},
     {"_integratecpp_Rcpp__integrator__get_relative_accuracy", (DL_FUNC) &_integratecpp_Rcpp__integrator__get_relative_accuracy, 1},
@@ -242,12 +524,26 @@ static const R_CallMethodDef CallEntries[] = {
     {"_integratecpp_Rcpp__integrator__set_absolute_accuracy", (DL_FUNC) &_integratecpp_Rcpp__integrator__set_absolute_accuracy, 2},
     {"_integratecpp_Rcpp__integrator__get_work_size", (DL_FUNC) &_integratecpp_Rcpp__integrator__get_work_size, 1},
     {"_integratecpp_Rcpp__integrator__set_work_size", (DL_FUNC) &_integratecpp_Rcpp__integrator__set_work_size, 2},
+    {"_integratecpp_Rcpp__integrator__get_backend", (DL_FUNC) &_integratecpp_Rcpp__integrator__get_backend, 1},
+    {"_integratecpp_Rcpp__integrator__set_backend", (DL_FUNC) &_integratecpp_Rcpp__integrator__set_backend, 2},
+    {"_integratecpp_Rcpp__integrator__get_rule_points", (DL_FUNC) &_integratecpp_Rcpp__integrator__get_rule_points, 1},
+    {"_integratecpp_Rcpp__integrator__set_rule_points", (DL_FUNC) &_integratecpp_Rcpp__integrator__set_rule_points, 2},
     {"_integratecpp_Rcpp__integrator__throw_if_invalid", (DL_FUNC) &_integratecpp_Rcpp__integrator__throw_if_invalid, 1},
-    {"_integratecpp_Rcpp__integrator__integrate", (DL_FUNC) &_integratecpp_Rcpp__integrator__integrate, 4},
+    {"_integratecpp_Rcpp__integrator__integrate", (DL_FUNC) &_integratecpp_Rcpp__integrator__integrate, 7},
+    {"_integratecpp_Rcpp__integrator__integrate_compiled", (DL_FUNC) &_integratecpp_Rcpp__integrator__integrate_compiled, 8},
+    {"_integratecpp_Rcpp__integrator__prepare", (DL_FUNC) &_integratecpp_Rcpp__integrator__prepare, 4},
+    {"_integratecpp_Rcpp__integrator__prepare_compiled", (DL_FUNC) &_integratecpp_Rcpp__integrator__prepare_compiled, 4},
+    {"_integratecpp_Rcpp__prepared_integration__run", (DL_FUNC) &_integratecpp_Rcpp__prepared_integration__run, 3},
+    {"_integratecpp_Rcpp__result_cache__new", (DL_FUNC) &_integratecpp_Rcpp__result_cache__new, 1},
+    {"_integratecpp_Rcpp__result_cache__stats", (DL_FUNC) &_integratecpp_Rcpp__result_cache__stats, 1},
+    {"_integratecpp_Rcpp__integrate_lazy", (DL_FUNC) &_integratecpp_Rcpp__integrate_lazy, 11},
+    {"_integratecpp_Rcpp__integrate_lazy_compiled", (DL_FUNC) &_integratecpp_Rcpp__integrate_lazy_compiled, 11},
     {NULL, NULL, 0}
 };
 
+void integratecpp_init_lazy_integrals(DllInfo* dll);
 RcppExport void R_init_integratecpp(DllInfo *dll) {
     R_registerRoutines(dll, NULL, CallEntries, NULL, NULL);
     R_useDynamicSymbols(dll, FALSE);
+    integratecpp_init_lazy_integrals(dll);
 }
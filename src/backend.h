@@ -0,0 +1,107 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <exception>
+#include <string>
+
+#include <Rcpp.h>
+
+#include "integratecpp.h"
+
+inline integratecpp::integrator::backend_type as_backend(
+    const std::string &name) {
+    if (name == "r_api") {
+        return integratecpp::integrator::backend_type::r_api;
+    } else if (name == "native") {
+        return integratecpp::integrator::backend_type::native;
+    } else if (name == "native_heap") {
+        return integratecpp::integrator::backend_type::native_heap;
+    } else if (name == "native_qng") {
+        return integratecpp::integrator::backend_type::native_qng;
+    } else if (name == "native_qag") {
+        return integratecpp::integrator::backend_type::native_qag;
+    } else if (name == "native_double_exponential") {
+        return integratecpp::integrator::backend_type::
+            native_double_exponential;
+    } else {
+        Rcpp::stop("the input is invalid");
+    }
+}
+
+inline std::string as_string(
+    const integratecpp::integrator::backend_type backend) {
+    switch (backend) {
+        case integratecpp::integrator::backend_type::native:
+            return "native";
+        case integratecpp::integrator::backend_type::native_heap:
+            return "native_heap";
+        case integratecpp::integrator::backend_type::native_qng:
+            return "native_qng";
+        case integratecpp::integrator::backend_type::native_qag:
+            return "native_qag";
+        case integratecpp::integrator::backend_type::native_double_exponential:
+            return "native_double_exponential";
+        default:
+            return "r_api";
+    }
+}
+
+inline std::string as_string(
+    const integratecpp::integrator::status_type status) {
+    switch (status) {
+        case integratecpp::integrator::status_type::success:
+            return "success";
+        case integratecpp::integrator::status_type::max_subdivisions:
+            return "max_subdivisions";
+        case integratecpp::integrator::status_type::roundoff:
+            return "roundoff";
+        case integratecpp::integrator::status_type::bad_integrand:
+            return "bad_integrand";
+        case integratecpp::integrator::status_type::extrapolation_roundoff:
+            return "extrapolation_roundoff";
+        case integratecpp::integrator::status_type::divergence:
+            return "divergence";
+        default:
+            return "invalid_input";
+    }
+}
+
+// NOTE: rethrows exceptions other than integration errors and invalid input.
+inline integratecpp::integrator::status_type as_status(
+    const std::exception_ptr &e_ptr) {
+    using status_type = integratecpp::integrator::status_type;
+    if (!e_ptr) {
+        return status_type::success;
+    }
+    try {
+        std::rethrow_exception(e_ptr);
+    } catch (const integratecpp::max_subdivision_error &e) {
+        return status_type::max_subdivisions;
+    } catch (const integratecpp::roundoff_error &e) {
+        return status_type::roundoff;
+    } catch (const integratecpp::bad_integrand_error &e) {
+        return status_type::bad_integrand;
+    } catch (const integratecpp::extrapolation_roundoff_error &e) {
+        return status_type::extrapolation_roundoff;
+    } catch (const integratecpp::divergence_error &e) {
+        return status_type::divergence;
+    } catch (const integratecpp::invalid_input_error &e) {
+        return status_type::invalid_input;
+    }
+}
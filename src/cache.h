@@ -0,0 +1,135 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <Rcpp.h>
+
+#include "integratecpp.h"
+
+// NOTE: a cache of successful integration results with least-recently-used
+// eviction, keyed on a user-supplied key identifying the integrand (including
+// its additional arguments or parameters), the bounds, and the configuration
+// parameters.
+class result_cache {
+   public:
+    struct key_type {
+        std::string key;
+        double lower;
+        double upper;
+        integratecpp::integrator::config_type config;
+
+        bool operator==(const key_type &other) const noexcept {
+            return key == other.key && lower == other.lower &&
+                   upper == other.upper &&
+                   config.max_subdivisions == other.config.max_subdivisions &&
+                   config.relative_accuracy ==
+                       other.config.relative_accuracy &&
+                   config.absolute_accuracy ==
+                       other.config.absolute_accuracy &&
+                   config.work_size == other.config.work_size &&
+                   config.backend == other.config.backend &&
+                   config.rule_points == other.config.rule_points;
+        }
+    };
+
+    explicit result_cache(const std::size_t capacity) : capacity_{capacity} {}
+
+    // NOTE: the cached result or `nullptr`, which is valid until the next
+    // insertion.
+    const integratecpp::integrator::return_type *find(const key_type &key) {
+        const auto it = index_.find(key);
+        if (it == index_.end()) {
+            ++misses_;
+            return nullptr;
+        }
+        ++hits_;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return &it->second->second;
+    }
+
+    void insert(key_type key,
+                const integratecpp::integrator::return_type &result) {
+        const auto it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->second = result;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return;
+        }
+        if (capacity_ == 0) {
+            return;
+        }
+        if (entries_.size() == capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+        entries_.emplace_front(std::move(key), result);
+        index_.emplace(entries_.front().first, entries_.begin());
+    }
+
+    std::size_t capacity() const noexcept { return capacity_; }
+    std::size_t size() const noexcept { return entries_.size(); }
+    std::size_t hits() const noexcept { return hits_; }
+    std::size_t misses() const noexcept { return misses_; }
+
+   private:
+    struct hash_type {
+        std::size_t operator()(const key_type &key) const noexcept {
+            auto seed = std::hash<std::string>{}(key.key);
+            combine(seed, std::hash<double>{}(key.lower));
+            combine(seed, std::hash<double>{}(key.upper));
+            combine(seed, std::hash<int>{}(key.config.max_subdivisions));
+            combine(seed, std::hash<double>{}(key.config.relative_accuracy));
+            combine(seed, std::hash<double>{}(key.config.absolute_accuracy));
+            combine(seed, std::hash<int>{}(key.config.work_size));
+            combine(seed,
+                    std::hash<int>{}(static_cast<int>(key.config.backend)));
+            combine(seed, std::hash<int>{}(key.config.rule_points));
+            return seed;
+        }
+
+        static void combine(std::size_t &seed, const std::size_t value) {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+    };
+
+    using entry_type =
+        std::pair<key_type, integratecpp::integrator::return_type>;
+
+    std::size_t capacity_;
+    std::size_t hits_{0};
+    std::size_t misses_{0};
+    std::list<entry_type> entries_{};
+    std::unordered_map<key_type, std::list<entry_type>::iterator, hash_type>
+        index_{};
+};
+
+// NOTE: the cache of an external pointer, or `nullptr` if the external pointer
+// is `NULL` or does not point to a cache, i.e., if caching is disabled.
+inline result_cache *as_result_cache(SEXP cache) {
+    if (TYPEOF(cache) != EXTPTRSXP) {
+        return nullptr;
+    }
+    return static_cast<result_cache *>(R_ExternalPtrAddr(cache));
+}
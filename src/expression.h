@@ -0,0 +1,207 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <Rcpp.h>
+
+// NOTE: a vectorized integrand for `integratecpp` evaluating a compiled
+// expression in the integration variable without calling into R. The program
+// is in postfix notation and is evaluated for all abscissae of a rule
+// application at once on a stack of arrays. The opcodes must match
+// `compile_expression()` in `R/expression.R`.
+class expression_integrand {
+   public:
+    enum class opcode : int {
+        variable = 0,
+        constant = 1,  // followed by the index of the constant
+        add = 2,
+        subtract = 3,
+        multiply = 4,
+        divide = 5,
+        power = 6,
+        negate = 7,
+        exp = 8,
+        log = 9,
+        sqrt = 10,
+        sin = 11,
+        cos = 12,
+        dnorm = 13,  // x, mean, sd
+        pnorm = 14   // x, mean, sd
+    };
+
+    expression_integrand(const std::vector<int> &code,
+                         const std::vector<double> &constants)
+        : code_{code}, constants_{constants} {
+        // NOTE: validate the program once by tracking the stack depth.
+        auto depth = std::size_t{0};
+        for (std::size_t pc = 0; pc < code_.size(); ++pc) {
+            switch (static_cast<opcode>(code_[pc])) {
+                case opcode::constant:
+                    if (++pc == code_.size() || code_[pc] < 0 ||
+                        static_cast<std::size_t>(code_[pc]) >=
+                            constants_.size()) {
+                        Rcpp::stop("the input is invalid");
+                    }
+                    ++depth;
+                    break;
+                case opcode::variable:
+                    ++depth;
+                    break;
+                case opcode::add:
+                case opcode::subtract:
+                case opcode::multiply:
+                case opcode::divide:
+                case opcode::power:
+                    depth = pop(depth, 2) + 1;
+                    break;
+                case opcode::negate:
+                case opcode::exp:
+                case opcode::log:
+                case opcode::sqrt:
+                case opcode::sin:
+                case opcode::cos:
+                    depth = pop(depth, 1) + 1;
+                    break;
+                case opcode::dnorm:
+                case opcode::pnorm:
+                    depth = pop(depth, 3) + 1;
+                    break;
+                default:
+                    Rcpp::stop("the input is invalid");
+            }
+            max_depth_ = std::max(max_depth_, depth);
+        }
+        if (depth != 1) {
+            Rcpp::stop("the input is invalid");
+        }
+    }
+
+    void operator()(const double *x, double *y, const int n) const {
+        // NOTE: the stack is reused across evaluations, i.e., the integrand
+        // must not be invoked concurrently.
+        stack_.resize(max_depth_ * n);
+        auto *top = stack_.data();
+        for (std::size_t pc = 0; pc < code_.size(); ++pc) {
+            switch (static_cast<opcode>(code_[pc])) {
+                case opcode::variable:
+                    top = std::copy_n(x, n, top);
+                    break;
+                case opcode::constant:
+                    top = std::fill_n(top, n, constants_[code_[++pc]]);
+                    break;
+                case opcode::add:
+                    top = binary(top, n, [](const double a, const double b) {
+                        return a + b;
+                    });
+                    break;
+                case opcode::subtract:
+                    top = binary(top, n, [](const double a, const double b) {
+                        return a - b;
+                    });
+                    break;
+                case opcode::multiply:
+                    top = binary(top, n, [](const double a, const double b) {
+                        return a * b;
+                    });
+                    break;
+                case opcode::divide:
+                    top = binary(top, n, [](const double a, const double b) {
+                        return a / b;
+                    });
+                    break;
+                case opcode::power:
+                    top = binary(top, n, [](const double a, const double b) {
+                        return R_pow(a, b);
+                    });
+                    break;
+                case opcode::negate:
+                    unary(top, n, [](const double a) { return -a; });
+                    break;
+                case opcode::exp:
+                    unary(top, n, [](const double a) { return std::exp(a); });
+                    break;
+                case opcode::log:
+                    unary(top, n, [](const double a) { return std::log(a); });
+                    break;
+                case opcode::sqrt:
+                    unary(top, n, [](const double a) { return std::sqrt(a); });
+                    break;
+                case opcode::sin:
+                    unary(top, n, [](const double a) { return std::sin(a); });
+                    break;
+                case opcode::cos:
+                    unary(top, n, [](const double a) { return std::cos(a); });
+                    break;
+                case opcode::dnorm:
+                    top = ternary(top, n, [](const double a, const double mean,
+                                             const double sd) {
+                        return R::dnorm(a, mean, sd, false);
+                    });
+                    break;
+                case opcode::pnorm:
+                    top = ternary(top, n, [](const double a, const double mean,
+                                             const double sd) {
+                        return R::pnorm(a, mean, sd, true, false);
+                    });
+                    break;
+            }
+        }
+        std::copy_n(stack_.data(), n, y);
+    }
+
+   private:
+    std::vector<int> code_;
+    std::vector<double> constants_;
+    std::size_t max_depth_{0};
+    mutable std::vector<double> stack_{};
+
+    static std::size_t pop(const std::size_t depth, const std::size_t count) {
+        if (depth < count) {
+            Rcpp::stop("the input is invalid");
+        }
+        return depth - count;
+    }
+
+    template <typename Fn_>
+    static void unary(double *top, const int n, Fn_ fn) {
+        std::transform(top - n, top, top - n, fn);
+    }
+
+    template <typename Fn_>
+    static double *binary(double *top, const int n, Fn_ fn) {
+        auto *b = top - n;
+        auto *a = b - n;
+        std::transform(a, b, b, a, fn);
+        return b;
+    }
+
+    template <typename Fn_>
+    static double *ternary(double *top, const int n, Fn_ fn) {
+        auto *c = top - n;
+        auto *b = c - n;
+        auto *a = b - n;
+        for (auto i = 0; i < n; ++i) {
+            a[i] = fn(a[i], b[i], c[i]);
+        }
+        return b;
+    }
+};
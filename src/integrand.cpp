@@ -0,0 +1,47 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include <Rcpp.h>
+
+#include "integrand.h"
+
+namespace {
+
+// NOTE: the density of the normal distribution with mean and standard
+// deviation in `ex`, or of the standard normal distribution if `ex` is null.
+double dnorm_scalar(double x, void *ex) {
+    const auto *params = static_cast<const double *>(ex);
+    return params == nullptr ? R::dnorm(x, 0., 1., false)
+                             : R::dnorm(x, params[0], params[1], false);
+}
+
+void dnorm_vectorized(double *x, int n, void *ex) {
+    for (auto i = 0; i < n; ++i) {
+        x[i] = dnorm_scalar(x[i], ex);
+    }
+}
+
+}  // namespace
+
+// [[Rcpp::export(rng=false)]]
+SEXP Rcpp__compiled_integrand__dnorm(const bool vectorized) {
+    return R_MakeExternalPtrFn(
+        vectorized ? reinterpret_cast<DL_FUNC>(&dnorm_vectorized)
+                   : reinterpret_cast<DL_FUNC>(&dnorm_scalar),
+        R_NilValue, R_NilValue);
+}
@@ -0,0 +1,238 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Rcpp.h>
+
+// NOTE: copies the function values returned by an R function for `n`
+// abscissae, validating their length and type (as `stats::integrate`).
+inline void copy_values(SEXP values, double *y, const int n) {
+    if (Rf_xlength(values) != n) {
+        Rcpp::stop("evaluation of function gave a result of wrong length");
+    }
+    if (TYPEOF(values) == INTSXP) {
+        std::transform(INTEGER(values), INTEGER(values) + n, y,
+                       [](const int value) {
+                           return value == NA_INTEGER ? NA_REAL : value;
+                       });
+    } else if (TYPEOF(values) == REALSXP) {
+        std::copy_n(REAL(values), n, y);
+    } else {
+        Rcpp::stop("evaluation of function gave a result of wrong type");
+    }
+}
+
+// NOTE: the message of the last R error without the call, formatted as by
+// `Rcpp::Rcpp_eval`.
+inline std::string last_error_message() {
+    const Rcpp::RObject call = Rf_lang1(Rf_install("geterrmessage"));
+    auto message = Rcpp::as<std::string>(Rf_eval(call, R_BaseEnv));
+    const auto pos = message.find(": ");
+    if (pos != std::string::npos) {
+        message.erase(0, pos + 2);
+    }
+    const auto first = message.find_first_not_of(" \n");
+    const auto last = message.find_last_not_of(" \n");
+    message = first == std::string::npos
+                  ? std::string{}
+                  : message.substr(first, last - first + 1);
+    return "Evaluation error: " + message + ".";
+}
+
+// NOTE: the `i`-th element of a vector of arguments as scalar, or of a list of
+// arguments as is.
+inline SEXP row_element(SEXP x, const R_xlen_t i) {
+    switch (TYPEOF(x)) {
+        case REALSXP:
+            return Rf_ScalarReal(REAL(x)[i]);
+        case INTSXP:
+            return Rf_ScalarInteger(INTEGER(x)[i]);
+        case LGLSXP:
+            return Rf_ScalarLogical(LOGICAL(x)[i]);
+        case STRSXP:
+            return Rf_ScalarString(STRING_ELT(x, i));
+        case VECSXP:
+            return VECTOR_ELT(x, i);
+        default:
+            Rcpp::stop("the input is invalid");
+    }
+}
+
+// NOTE: a vectorized integrand for `integratecpp`, which passes all abscissae
+// of a rule application to the R function at once (as `stats::integrate`).
+// Non-finite function values are reported by `integratecpp` itself.
+//
+// The call `fn(x, ...)`, optionally with the (named) additional arguments
+// `args` or their `i`-th elements, is constructed once per length of `x`, i.e.,
+// at most three times, with a preallocated argument vector for the abscissae.
+// The argument vector is only replaced if the R function keeps a reference to
+// it, and calls are evaluated by `R_tryEvalSilent`. Hence, no R objects are
+// allocated besides those allocated by the R function itself.
+class vectorized_r_integrand {
+   public:
+    explicit vectorized_r_integrand(const Rcpp::Function &fn)
+        : call_{Rf_lang2(fn, R_NilValue)} {}
+
+    vectorized_r_integrand(const Rcpp::Function &fn, const Rcpp::List &args)
+        : call_{make_call(fn, args, [&args](const R_xlen_t k) {
+              return VECTOR_ELT(args, k);
+          })} {}
+
+    vectorized_r_integrand(const Rcpp::Function &fn, const Rcpp::List &args,
+                           const R_xlen_t i)
+        : call_{make_call(fn, args, [&args, i](const R_xlen_t k) {
+              return row_element(VECTOR_ELT(args, k), i);
+          })} {}
+
+    void operator()(const double *x, double *y, const int n) const {
+        const auto call = call_for(n);
+        const auto buffer = CADR(call);
+        std::copy_n(x, n, REAL(buffer));
+        auto error = 0;
+        // NOTE: the values are not protected since nothing is allocated
+        // until they are copied.
+        const auto values = R_tryEvalSilent(call, R_GlobalEnv, &error);
+        if (error) {
+            Rcpp::stop(last_error_message());
+        }
+        copy_values(values, y, n);
+        // NOTE: the call holds the only reference to the argument vector
+        // unless the R function, e.g., returned a closure capturing it.
+        if (MAYBE_SHARED(buffer)) {
+            SETCADR(call, Rf_allocVector(REALSXP, n));
+        }
+    }
+
+   private:
+    Rcpp::RObject call_;
+    mutable std::vector<std::pair<int, Rcpp::RObject>> calls_{};
+
+    template <typename Element_>
+    static SEXP make_call(const Rcpp::Function &fn, const Rcpp::List &args,
+                          Element_ &&element) {
+        Rcpp::RObject tail = R_NilValue;
+        const auto names = Rf_getAttrib(args, R_NamesSymbol);
+        for (auto k = args.size(); k-- > 0;) {
+            tail = Rf_cons(element(k), tail);
+            if (!Rf_isNull(names) && *CHAR(STRING_ELT(names, k)) != '\0') {
+                SET_TAG(tail, Rf_installChar(STRING_ELT(names, k)));
+            }
+        }
+        tail = Rf_cons(R_NilValue, tail);
+        return Rf_lcons(fn, tail);
+    }
+
+    SEXP call_for(const int n) const {
+        const auto it =
+            std::find_if(calls_.begin(), calls_.end(),
+                         [n](const std::pair<int, Rcpp::RObject> &call) {
+                             return call.first == n;
+                         });
+        if (it != calls_.end()) {
+            return it->second;
+        }
+        // NOTE: the argument vector is protected by the protection stack
+        // instead of `Rcpp`, which would add references to it.
+        const auto buffer = PROTECT(Rf_allocVector(REALSXP, n));
+        const auto tail = PROTECT(Rf_cons(buffer, CDDR(call_)));
+        const Rcpp::RObject call = Rf_lcons(CAR(call_), tail);
+        UNPROTECT(2);
+        calls_.emplace_back(n, call);
+        return calls_.back().second;
+    }
+};
+
+// NOTE: a scalar integrand for `integratecpp`, which passes single abscissae
+// to a vectorized integrand.
+template <typename Integrand_>
+class scalar_adapter {
+   public:
+    explicit scalar_adapter(Integrand_ integrand)
+        : integrand_{std::move(integrand)} {}
+
+    double operator()(const double x) const {
+        auto y = 0.;
+        integrand_(&x, &y, 1);
+        return y;
+    }
+
+   private:
+    Integrand_ integrand_;
+};
+
+// NOTE: integrands compiled to native code, passed from R as external pointers
+// to functions with the signature of `integr_fn` from `R_ext/Applic.h`
+// (vectorized, the function values replace the abscissae) or of `scalar_fn`.
+// The opaque parameter pointer `ex` is passed through.
+using scalar_fn = double(double, void *);
+using vectorized_fn = void(double *, int, void *);
+
+class compiled_integrand {
+   public:
+    compiled_integrand(scalar_fn *fn, void *ex) noexcept : fn_{fn}, ex_{ex} {}
+
+    double operator()(const double x) const { return fn_(x, ex_); }
+
+   private:
+    scalar_fn *fn_;
+    void *ex_;
+};
+
+class vectorized_compiled_integrand {
+   public:
+    vectorized_compiled_integrand(vectorized_fn *fn, void *ex) noexcept
+        : fn_{fn}, ex_{ex} {}
+
+    void operator()(const double *x, double *y, const int n) const {
+        std::copy_n(x, n, y);
+        fn_(y, n, ex_);
+    }
+
+   private:
+    vectorized_fn *fn_;
+    void *ex_;
+};
+
+// NOTE: the function pointer of an external pointer created with
+// `R_MakeExternalPtrFn` (or `R_MakeExternalPtr`).
+template <typename Fn_>
+inline Fn_ *as_function_pointer(SEXP fn) {
+    if (TYPEOF(fn) != EXTPTRSXP || R_ExternalPtrAddr(fn) == nullptr) {
+        Rcpp::stop("the input is invalid");
+    }
+    return reinterpret_cast<Fn_ *>(R_ExternalPtrAddrFn(fn));
+}
+
+// NOTE: the opaque parameter pointer for `NULL`, an external pointer, or the
+// data of a double vector, which is owned by the caller.
+inline void *as_parameter_pointer(SEXP params) {
+    if (Rf_isNull(params)) {
+        return nullptr;
+    } else if (TYPEOF(params) == EXTPTRSXP) {
+        return R_ExternalPtrAddr(params);
+    } else if (TYPEOF(params) == REALSXP) {
+        return static_cast<void *>(REAL(params));
+    } else {
+        Rcpp::stop("the input is invalid");
+    }
+}
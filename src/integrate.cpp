@@ -16,27 +16,279 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <cmath>
+#include <cstddef>
+#include <exception>
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <Rcpp.h>
 
+#include "backend.h"
+#include "expression.h"
+#include "integrand.h"
 #include "integratecpp.h"
 
 // [[Rcpp::export(rng=false)]]
 Rcpp::List Rcpp__integrate(Rcpp::Function fn, const double lower,
-                           const double upper, const int max_subdivisions,
+                           const double upper,
+                           const std::vector<double> points,
+                           const int max_subdivisions,
                            const double relative_accuracy,
                            const double absolute_accuracy,
-                           const int work_size) {
-    auto fn_ = [&fn](const double x) { return Rcpp::as<double>(fn(x)); };
-    decltype(integratecpp::integrate(fn_, lower, upper)) result;
+                           const int work_size, const std::string backend,
+                           const int rule_points, const bool vectorized) {
+    const auto integrand = vectorized_r_integrand{fn};
+    integratecpp::integrator::return_type result;
     std::string message;
     try {
-        auto cfg = integratecpp::integrator::config_type{
-            max_subdivisions, relative_accuracy, absolute_accuracy, work_size};
-        result = integratecpp::integrate(fn_, lower, upper, std::move(cfg));
+        const auto integrator =
+            integratecpp::integrator{integratecpp::integrator::config_type{
+                max_subdivisions, relative_accuracy, absolute_accuracy,
+                work_size, as_backend(backend), rule_points}};
+        result = vectorized
+                     ? integrator(integrand, lower, upper, points)
+                     : integrator(
+                           scalar_adapter<vectorized_r_integrand>{integrand},
+                           lower, upper, points);
+        message = "OK";
+    } catch (const Rcpp::exception &e) {
+        Rcpp::stop(e.what());
+    } catch (const integratecpp::integration_runtime_error &e) {
+        result = e.result();
+        message = e.what();
+    } catch (const integratecpp::integration_logic_error &e) {
+        result = e.result();
+        message = e.what();
+    } catch (const std::exception &e) {
+        Rcpp::stop(e.what());  // # nocov
+    } catch (...) {
+        Rcpp::stop("Unexpected error");  // # nocov
+    }
+    return Rcpp::List::create(Rcpp::Named("value") = result.value,
+                              Rcpp::Named("abs.error") = result.absolute_error,
+                              Rcpp::Named("subdivisions") = result.subdivisions,
+                              Rcpp::Named("message") = message);
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List Rcpp__integrate_compiled(SEXP fn, SEXP params, const double lower,
+                                    const double upper,
+                                    const std::vector<double> points,
+                                    const int max_subdivisions,
+                                    const double relative_accuracy,
+                                    const double absolute_accuracy,
+                                    const int work_size,
+                                    const std::string backend,
+                                    const int rule_points,
+                                    const bool vectorized) {
+    auto *ex = as_parameter_pointer(params);
+    integratecpp::integrator::return_type result;
+    std::string message;
+    try {
+        const auto integrator =
+            integratecpp::integrator{integratecpp::integrator::config_type{
+                max_subdivisions, relative_accuracy, absolute_accuracy,
+                work_size, as_backend(backend), rule_points}};
+        result = vectorized
+                     ? integrator(vectorized_compiled_integrand{
+                                      as_function_pointer<vectorized_fn>(fn),
+                                      ex},
+                                  lower, upper, points)
+                     : integrator(compiled_integrand{
+                                      as_function_pointer<scalar_fn>(fn), ex},
+                                  lower, upper, points);
+        message = "OK";
+    } catch (const Rcpp::exception &e) {
+        Rcpp::stop(e.what());
+    } catch (const integratecpp::integration_runtime_error &e) {
+        result = e.result();
+        message = e.what();
+    } catch (const integratecpp::integration_logic_error &e) {
+        result = e.result();
+        message = e.what();
+    } catch (const std::exception &e) {
+        Rcpp::stop(e.what());  // # nocov
+    } catch (...) {
+        Rcpp::stop("Unexpected error");  // # nocov
+    }
+    return Rcpp::List::create(Rcpp::Named("value") = result.value,
+                              Rcpp::Named("abs.error") = result.absolute_error,
+                              Rcpp::Named("subdivisions") = result.subdivisions,
+                              Rcpp::Named("message") = message);
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List Rcpp__integrate_many(Rcpp::Function fn,
+                                const Rcpp::NumericVector lower,
+                                const Rcpp::NumericVector upper,
+                                const Rcpp::List args,
+                                const int max_subdivisions,
+                                const double relative_accuracy,
+                                const double absolute_accuracy,
+                                const int work_size, const std::string backend,
+                                const int rule_points, const bool vectorized) {
+    const auto n = lower.size();
+    auto value = Rcpp::NumericVector(n);
+    auto absolute_error = Rcpp::NumericVector(n);
+    auto subdivisions = Rcpp::IntegerVector(n);
+    auto neval = Rcpp::IntegerVector(n);
+    auto status = Rcpp::CharacterVector(n);
+    try {
+        const auto integrator =
+            integratecpp::integrator{integratecpp::integrator::config_type{
+                max_subdivisions, relative_accuracy, absolute_accuracy,
+                work_size, as_backend(backend), rule_points}};
+        integratecpp::detail::throw_if_invalid_config(integrator.config());
+
+        auto workspace = integratecpp::integrator::workspace_type{};
+        auto result = integratecpp::integrator::return_type{};
+        for (R_xlen_t i = 0; i < n; ++i) {
+            const auto integrand = vectorized_r_integrand{fn, args, i};
+            const auto code =
+                vectorized
+                    ? integrator.try_integrate(integrand, lower[i], upper[i],
+                                               result, workspace)
+                    : integrator.try_integrate(
+                          scalar_adapter<vectorized_r_integrand>{integrand},
+                          lower[i], upper[i], result, workspace);
+            value[i] = result.value;
+            absolute_error[i] = result.absolute_error;
+            subdivisions[i] = result.subdivisions;
+            neval[i] = result.neval;
+            status[i] = as_string(code);
+        }
+    } catch (const Rcpp::exception &e) {
+        Rcpp::stop(e.what());
+    } catch (const std::exception &e) {
+        Rcpp::stop(e.what());
+    } catch (...) {
+        Rcpp::stop("Unexpected error");  // # nocov
+    }
+    return Rcpp::List::create(Rcpp::Named("value") = value,
+                              Rcpp::Named("abs.error") = absolute_error,
+                              Rcpp::Named("subdivisions") = subdivisions,
+                              Rcpp::Named("neval") = neval,
+                              Rcpp::Named("status") = status);
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List Rcpp__integrate_many_compiled(
+    SEXP fn, SEXP params, const Rcpp::NumericVector lower,
+    const Rcpp::NumericVector upper, const int max_subdivisions,
+    const double relative_accuracy, const double absolute_accuracy,
+    const int work_size, const std::string backend, const int rule_points,
+    const bool vectorized, const int thread_count) {
+    const auto n = static_cast<std::size_t>(lower.size());
+    auto *ex = as_parameter_pointer(params);
+    auto out = std::vector<integratecpp::integrator::return_type>(n);
+    auto errors = std::vector<std::exception_ptr>(n);
+    auto value = Rcpp::NumericVector(n);
+    auto absolute_error = Rcpp::NumericVector(n);
+    auto subdivisions = Rcpp::IntegerVector(n);
+    auto neval = Rcpp::IntegerVector(n);
+    auto status = Rcpp::CharacterVector(n);
+    try {
+        const auto integrator =
+            integratecpp::integrator{integratecpp::integrator::config_type{
+                max_subdivisions, relative_accuracy, absolute_accuracy,
+                work_size, as_backend(backend), rule_points}};
+        // NOTE: the workers neither call into R nor allocate R objects; the
+        // results are marshaled after all workers have joined.
+        if (vectorized) {
+            integrator.integrate_batch_parallel(
+                vectorized_compiled_integrand{
+                    as_function_pointer<vectorized_fn>(fn), ex},
+                lower.begin(), upper.begin(), n, out.data(), errors.data(),
+                thread_count);
+        } else {
+            integrator.integrate_batch_parallel(
+                compiled_integrand{as_function_pointer<scalar_fn>(fn), ex},
+                lower.begin(), upper.begin(), n, out.data(), errors.data(),
+                thread_count);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            value[i] = out[i].value;
+            absolute_error[i] = out[i].absolute_error;
+            subdivisions[i] = out[i].subdivisions;
+            neval[i] = out[i].neval;
+            status[i] = as_string(as_status(errors[i]));
+        }
+    } catch (const Rcpp::exception &e) {
+        Rcpp::stop(e.what());
+    } catch (const std::exception &e) {
+        Rcpp::stop(e.what());
+    } catch (...) {
+        Rcpp::stop("Unexpected error");  // # nocov
+    }
+    return Rcpp::List::create(Rcpp::Named("value") = value,
+                              Rcpp::Named("abs.error") = absolute_error,
+                              Rcpp::Named("subdivisions") = subdivisions,
+                              Rcpp::Named("neval") = neval,
+                              Rcpp::Named("status") = status);
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List Rcpp__integrate_parallel_compiled(
+    SEXP fn, SEXP params, const double lower, const double upper,
+    const int max_subdivisions, const double relative_accuracy,
+    const double absolute_accuracy, const int work_size, const bool vectorized,
+    const int thread_count, const int bisections) {
+    auto *ex = as_parameter_pointer(params);
+    integratecpp::integrator::return_type result;
+    std::string message;
+    try {
+        const auto integrator =
+            integratecpp::integrator{integratecpp::integrator::config_type{
+                max_subdivisions, relative_accuracy, absolute_accuracy,
+                work_size}};
+        // NOTE: the workers neither call into R nor allocate R objects.
+        result = vectorized
+                     ? integrator.integrate_parallel(
+                           vectorized_compiled_integrand{
+                               as_function_pointer<vectorized_fn>(fn), ex},
+                           lower, upper, thread_count, bisections)
+                     : integrator.integrate_parallel(
+                           compiled_integrand{
+                               as_function_pointer<scalar_fn>(fn), ex},
+                           lower, upper, thread_count, bisections);
+        message = "OK";
+    } catch (const Rcpp::exception &e) {
+        Rcpp::stop(e.what());
+    } catch (const integratecpp::integration_runtime_error &e) {
+        result = e.result();
+        message = e.what();
+    } catch (const integratecpp::integration_logic_error &e) {
+        result = e.result();
+        message = e.what();
+    } catch (const std::exception &e) {
+        Rcpp::stop(e.what());  // # nocov
+    } catch (...) {
+        Rcpp::stop("Unexpected error");  // # nocov
+    }
+    return Rcpp::List::create(Rcpp::Named("value") = result.value,
+                              Rcpp::Named("abs.error") = result.absolute_error,
+                              Rcpp::Named("subdivisions") = result.subdivisions,
+                              Rcpp::Named("message") = message);
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List Rcpp__integrate_expression(
+    const std::vector<int> code, const std::vector<double> constants,
+    const double lower, const double upper, const std::vector<double> points,
+    const int max_subdivisions, const double relative_accuracy,
+    const double absolute_accuracy, const int work_size,
+    const std::string backend, const int rule_points) {
+    integratecpp::integrator::return_type result;
+    std::string message;
+    try {
+        const auto fn = expression_integrand{code, constants};
+        const auto integrator =
+            integratecpp::integrator{integratecpp::integrator::config_type{
+                max_subdivisions, relative_accuracy, absolute_accuracy,
+                work_size, as_backend(backend), rule_points}};
+        result = integrator(fn, lower, upper, points);
         message = "OK";
     } catch (const Rcpp::exception &e) {
         Rcpp::stop(e.what());
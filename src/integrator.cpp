@@ -22,14 +22,21 @@
 
 #include <Rcpp.h>
 
+#include "backend.h"
+#include "cache.h"
+#include "integrand.h"
 #include "integratecpp.h"
+#include "prepared.h"
 
 // [[Rcpp::export(rng=false)]]
 Rcpp::XPtr<integratecpp::integrator> Rcpp__integrator__new(
     const int max_subdivisions, const double relative_accuracy,
-    const double absolute_accuracy, const int work_size) {
-    return Rcpp::XPtr<integratecpp::integrator>(new integratecpp::integrator{
-        max_subdivisions, relative_accuracy, absolute_accuracy, work_size});
+    const double absolute_accuracy, const int work_size,
+    const std::string backend, const int rule_points) {
+    return Rcpp::XPtr<integratecpp::integrator>(
+        new integratecpp::integrator{integratecpp::integrator::config_type{
+            max_subdivisions, relative_accuracy, absolute_accuracy, work_size,
+            as_backend(backend), rule_points}});
 }
 
 // [[Rcpp::export(rng=false)]]
@@ -75,14 +82,33 @@ void Rcpp__integrator__set_work_size(Rcpp::XPtr<integratecpp::integrator> ptr,
     ptr->work_size(work_size);
 }
 
+// [[Rcpp::export(rng=false)]]
+std::string Rcpp__integrator__get_backend(
+    Rcpp::XPtr<integratecpp::integrator> ptr) {
+    return as_string(ptr->backend());
+}
+// [[Rcpp::export(rng=false)]]
+void Rcpp__integrator__set_backend(Rcpp::XPtr<integratecpp::integrator> ptr,
+                                   const std::string backend) {
+    ptr->backend(as_backend(backend));
+}
+
+// [[Rcpp::export(rng=false)]]
+int Rcpp__integrator__get_rule_points(
+    Rcpp::XPtr<integratecpp::integrator> ptr) {
+    return ptr->rule_points();
+}
+// [[Rcpp::export(rng=false)]]
+void Rcpp__integrator__set_rule_points(
+    Rcpp::XPtr<integratecpp::integrator> ptr, const int rule_points) {
+    ptr->rule_points(rule_points);
+}
+
 // [[Rcpp::export(rng=false)]]
 void Rcpp__integrator__throw_if_invalid(
     Rcpp::XPtr<integratecpp::integrator> ptr) {
     try {
-        // NOTE: avoid code duplication using a dummy integration. the
-        // integration itself should not fail under any circumstances if
-        // configuration parameters are valid.
-        (*ptr)([](const double) noexcept { return 0.; }, 0., 1.);
+        integratecpp::detail::throw_if_invalid_config(ptr->config());
     } catch (::Rcpp::exception &e) {                        // # nocov
         Rcpp::stop("Not initialized");                      // # nocov
     } catch (const integratecpp::invalid_input_error &e) {  // # nocov
@@ -92,31 +118,161 @@ void Rcpp__integrator__throw_if_invalid(
     }
 }
 
+namespace {
+
+// NOTE: the result list of `Integrator$integrate()`, looking up and inserting
+// successful results in the cache if it is enabled and `key` is not `NULL`.
+template <typename Integrate_>
+Rcpp::List cached_integrate(const integratecpp::integrator &integrator,
+                            SEXP cache, SEXP key, const double lower,
+                            const double upper, Integrate_ &&integrate) {
+    auto *results = Rf_isNull(key) ? nullptr : as_result_cache(cache);
+    auto cache_key = result_cache::key_type{};
+    const integratecpp::integrator::return_type *hit = nullptr;
+    if (results != nullptr) {
+        cache_key = result_cache::key_type{Rcpp::as<std::string>(key), lower,
+                                           upper, integrator.config()};
+        hit = results->find(cache_key);
+    }
+
+    integratecpp::integrator::return_type result;
+    std::string message;
+    if (hit != nullptr) {
+        result = *hit;
+        message = "OK";
+    } else {
+        try {
+            result = integrate();
+            message = "OK";
+        } catch (const Rcpp::exception &e) {
+            Rcpp::stop(e.what());
+        } catch (const integratecpp::integration_runtime_error &e) {
+            result = e.result();
+            message = e.what();
+        } catch (const integratecpp::integration_logic_error &e) {
+            result = e.result();
+            message = e.what();
+        } catch (const std::exception &e) {
+            Rcpp::stop(e.what());  // # nocov
+        } catch (...) {
+            Rcpp::stop("Unexpected error");  // # nocov
+        }
+        if (results != nullptr && message == "OK") {
+            results->insert(std::move(cache_key), result);
+        }
+    }
+    return Rcpp::List::create(Rcpp::Named("value") = result.value,
+                              Rcpp::Named("abs.error") = result.absolute_error,
+                              Rcpp::Named("subdivisions") = result.subdivisions,
+                              Rcpp::Named("message") = message);
+}
+
+}  // namespace
+
 // [[Rcpp::export(rng=false)]]
 Rcpp::List Rcpp__integrator__integrate(Rcpp::XPtr<integratecpp::integrator> ptr,
                                        Rcpp::Function fn, const double lower,
+                                       const double upper,
+                                       const bool vectorized, SEXP cache,
+                                       SEXP key) {
+    const auto integrand = vectorized_r_integrand{fn};
+    return cached_integrate(*ptr, cache, key, lower, upper, [&]() {
+        return vectorized
+                   ? (*ptr)(integrand, lower, upper)
+                   : (*ptr)(scalar_adapter<vectorized_r_integrand>{integrand},
+                            lower, upper);
+    });
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List Rcpp__integrator__integrate_compiled(
+    Rcpp::XPtr<integratecpp::integrator> ptr, SEXP fn, SEXP params,
+    const double lower, const double upper, const bool vectorized, SEXP cache,
+    SEXP key) {
+    auto *ex = as_parameter_pointer(params);
+    return cached_integrate(*ptr, cache, key, lower, upper, [&]() {
+        return vectorized
+                   ? (*ptr)(vectorized_compiled_integrand{
+                                as_function_pointer<vectorized_fn>(fn), ex},
+                            lower, upper)
+                   : (*ptr)(compiled_integrand{
+                                as_function_pointer<scalar_fn>(fn), ex},
+                            lower, upper);
+    });
+}
+
+// [[Rcpp::export(rng=false)]]
+SEXP Rcpp__integrator__prepare(Rcpp::XPtr<integratecpp::integrator> ptr,
+                               Rcpp::Function fn, const Rcpp::List args,
+                               const bool vectorized) {
+    const auto config = ptr->config();
+    if (!integratecpp::detail::is_valid_config(config)) {
+        Rcpp::stop("the input is invalid");
+    }
+    auto integrand = vectorized_r_integrand{fn, args};
+    return Rcpp::XPtr<prepared_integration>(
+        vectorized ? make_prepared_integration(config, std::move(integrand))
+                   : make_prepared_integration(
+                         config, scalar_adapter<vectorized_r_integrand>{
+                                     std::move(integrand)}));
+}
+
+// [[Rcpp::export(rng=false)]]
+SEXP Rcpp__integrator__prepare_compiled(
+    Rcpp::XPtr<integratecpp::integrator> ptr, SEXP fn, SEXP params,
+    const bool vectorized) {
+    const auto config = ptr->config();
+    if (!integratecpp::detail::is_valid_config(config)) {
+        Rcpp::stop("the input is invalid");
+    }
+    auto *ex = as_parameter_pointer(params);
+    return Rcpp::XPtr<prepared_integration>(
+        vectorized ? make_prepared_integration(
+                         config,
+                         vectorized_compiled_integrand{
+                             as_function_pointer<vectorized_fn>(fn), ex},
+                         params)
+                   : make_prepared_integration(
+                         config,
+                         compiled_integrand{as_function_pointer<scalar_fn>(fn),
+                                            ex},
+                         params));
+}
+
+// [[Rcpp::export(rng=false)]]
+double Rcpp__prepared_integration__run(SEXP ptr, const double lower,
                                        const double upper) {
-    auto fn_ = [&fn](const double x) { return Rcpp::as<double>(fn(x)); };
-    decltype(integratecpp::integrate(fn_, lower, upper)) result;
-    std::string message;
     try {
-        result = (*ptr)(fn_, lower, upper);
-        message = "OK";
+        return Rcpp::XPtr<prepared_integration>(ptr)->run(lower, upper);
     } catch (const Rcpp::exception &e) {
         Rcpp::stop(e.what());
-    } catch (const integratecpp::integration_runtime_error &e) {
-        result = e.result();
-        message = e.what();
-    } catch (const integratecpp::integration_logic_error &e) {
-        result = e.result();
-        message = e.what();
     } catch (const std::exception &e) {
-        Rcpp::stop(e.what());  // # nocov
+        Rcpp::stop(e.what());
     } catch (...) {
         Rcpp::stop("Unexpected error");  // # nocov
     }
-    return Rcpp::List::create(Rcpp::Named("value") = result.value,
-                              Rcpp::Named("abs.error") = result.absolute_error,
-                              Rcpp::Named("subdivisions") = result.subdivisions,
-                              Rcpp::Named("message") = message);
+}
+
+// [[Rcpp::export(rng=false)]]
+SEXP Rcpp__result_cache__new(const int capacity) {
+    if (capacity < 0) {
+        Rcpp::stop("the input is invalid");
+    }
+    return Rcpp::XPtr<result_cache>(
+        new result_cache{static_cast<std::size_t>(capacity)});
+}
+
+// [[Rcpp::export(rng=false)]]
+Rcpp::List Rcpp__result_cache__stats(SEXP ptr) {
+    const auto *results = as_result_cache(ptr);
+    if (results == nullptr) {
+        return Rcpp::List::create(
+            Rcpp::Named("capacity") = 0., Rcpp::Named("size") = 0.,
+            Rcpp::Named("hits") = 0., Rcpp::Named("misses") = 0.);
+    }
+    return Rcpp::List::create(
+        Rcpp::Named("capacity") = static_cast<double>(results->capacity()),
+        Rcpp::Named("size") = static_cast<double>(results->size()),
+        Rcpp::Named("hits") = static_cast<double>(results->hits()),
+        Rcpp::Named("misses") = static_cast<double>(results->misses()));
 }
@@ -0,0 +1,197 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Rcpp.h>
+#include <R_ext/Altrep.h>
+
+#include "backend.h"
+#include "integrand.h"
+#include "integratecpp.h"
+#include "lazy.h"
+#include "prepared.h"
+
+namespace {
+
+R_altrep_class_t lazy_integrals_class;
+
+// NOTE: the integrals are held by an external pointer in `data1`; `data2` is
+// `NULL` until the vector is materialized by a request of its data pointer.
+lazy_integrals *as_lazy_integrals(SEXP x) {
+    return static_cast<lazy_integrals *>(
+        R_ExternalPtrAddr(R_altrep_data1(x)));
+}
+
+// NOTE: ALTREP methods are called from C and must not throw. Errors are
+// signaled by `Rf_error` once the exception has been destroyed.
+template <typename Fn_>
+auto call_or_error(Fn_ &&fn) -> decltype(fn()) {
+    char message[1024];
+    try {
+        return fn();
+    } catch (const std::exception &e) {
+        std::strncpy(message, e.what(), sizeof(message) - 1);
+        message[sizeof(message) - 1] = '\0';
+    } catch (...) {
+        std::strcpy(message, "Unexpected error");  // # nocov
+    }
+    Rf_error("%s", message);
+}
+
+R_xlen_t lazy_integrals_length(SEXP x) {
+    const auto values = R_altrep_data2(x);
+    return Rf_isNull(values) ? as_lazy_integrals(x)->size()
+                             : Rf_xlength(values);
+}
+
+double lazy_integrals_elt(SEXP x, const R_xlen_t i) {
+    const auto values = R_altrep_data2(x);
+    if (!Rf_isNull(values)) {
+        return REAL(values)[i];
+    }
+    auto *integrals = as_lazy_integrals(x);
+    return call_or_error([integrals, i]() { return (*integrals)[i]; });
+}
+
+R_xlen_t lazy_integrals_get_region(SEXP x, const R_xlen_t i, const R_xlen_t n,
+                                   double *buf) {
+    const auto size = lazy_integrals_length(x);
+    const auto count = std::min(n, size - i);
+    for (R_xlen_t k = 0; k < count; ++k) {
+        buf[k] = lazy_integrals_elt(x, i + k);
+    }
+    return count;
+}
+
+void *lazy_integrals_dataptr(SEXP x, Rboolean) {
+    if (Rf_isNull(R_altrep_data2(x))) {
+        auto *integrals = as_lazy_integrals(x);
+        const auto n = integrals->size();
+        const auto values = PROTECT(Rf_allocVector(REALSXP, n));
+        auto *out = REAL(values);
+        call_or_error([integrals, n, out]() {
+            for (R_xlen_t i = 0; i < n; ++i) {
+                out[i] = (*integrals)[i];
+            }
+        });
+        R_set_altrep_data2(x, values);
+        UNPROTECT(1);
+    }
+    return static_cast<void *>(REAL(R_altrep_data2(x)));
+}
+
+const void *lazy_integrals_dataptr_or_null(SEXP x) {
+    const auto values = R_altrep_data2(x);
+    return Rf_isNull(values) ? nullptr
+                             : static_cast<const void *>(REAL(values));
+}
+
+Rboolean lazy_integrals_inspect(SEXP x, int, int, int,
+                                void (*)(SEXP, int, int, int)) {
+    if (Rf_isNull(R_altrep_data2(x))) {
+        const auto *integrals = as_lazy_integrals(x);
+        Rprintf(" lazy_integrals (%.0f of %.0f computed)\n",
+                static_cast<double>(integrals->computed()),
+                static_cast<double>(integrals->size()));
+    } else {
+        Rprintf(" lazy_integrals (materialized)\n");
+    }
+    return TRUE;
+}
+
+SEXP make_lazy_integrals(prepared_integration *integration,
+                         const Rcpp::NumericVector &lower,
+                         const Rcpp::NumericVector &upper) {
+    auto integrals = Rcpp::XPtr<lazy_integrals>(new lazy_integrals{
+        std::unique_ptr<prepared_integration>{integration},
+        std::vector<double>(lower.begin(), lower.end()),
+        std::vector<double>(upper.begin(), upper.end())});
+    return R_new_altrep(lazy_integrals_class, integrals, R_NilValue);
+}
+
+}  // namespace
+
+// [[Rcpp::init]]
+void integratecpp_init_lazy_integrals(DllInfo *dll) {
+    lazy_integrals_class =
+        R_make_altreal_class("lazy_integrals", "integratecpp", dll);
+    R_set_altrep_Length_method(lazy_integrals_class, lazy_integrals_length);
+    R_set_altrep_Inspect_method(lazy_integrals_class, lazy_integrals_inspect);
+    R_set_altvec_Dataptr_method(lazy_integrals_class, lazy_integrals_dataptr);
+    R_set_altvec_Dataptr_or_null_method(lazy_integrals_class,
+                                        lazy_integrals_dataptr_or_null);
+    R_set_altreal_Elt_method(lazy_integrals_class, lazy_integrals_elt);
+    R_set_altreal_Get_region_method(lazy_integrals_class,
+                                    lazy_integrals_get_region);
+}
+
+// [[Rcpp::export(rng=false)]]
+SEXP Rcpp__integrate_lazy(Rcpp::Function fn, const Rcpp::List args,
+                          const Rcpp::NumericVector lower,
+                          const Rcpp::NumericVector upper,
+                          const int max_subdivisions,
+                          const double relative_accuracy,
+                          const double absolute_accuracy, const int work_size,
+                          const std::string backend, const int rule_points,
+                          const bool vectorized) {
+    const auto config = integratecpp::integrator::config_type{
+        max_subdivisions, relative_accuracy, absolute_accuracy, work_size,
+        as_backend(backend), rule_points};
+    if (!integratecpp::detail::is_valid_config(config)) {
+        Rcpp::stop("the input is invalid");
+    }
+    auto integrand = vectorized_r_integrand{fn, args};
+    return make_lazy_integrals(
+        vectorized ? make_prepared_integration(config, std::move(integrand))
+                   : make_prepared_integration(
+                         config, scalar_adapter<vectorized_r_integrand>{
+                                     std::move(integrand)}),
+        lower, upper);
+}
+
+// [[Rcpp::export(rng=false)]]
+SEXP Rcpp__integrate_lazy_compiled(
+    SEXP fn, SEXP params, const Rcpp::NumericVector lower,
+    const Rcpp::NumericVector upper, const int max_subdivisions,
+    const double relative_accuracy, const double absolute_accuracy,
+    const int work_size, const std::string backend, const int rule_points,
+    const bool vectorized) {
+    const auto config = integratecpp::integrator::config_type{
+        max_subdivisions, relative_accuracy, absolute_accuracy, work_size,
+        as_backend(backend), rule_points};
+    if (!integratecpp::detail::is_valid_config(config)) {
+        Rcpp::stop("the input is invalid");
+    }
+    auto *ex = as_parameter_pointer(params);
+    return make_lazy_integrals(
+        vectorized ? make_prepared_integration(
+                         config,
+                         vectorized_compiled_integrand{
+                             as_function_pointer<vectorized_fn>(fn), ex},
+                         params)
+                   : make_prepared_integration(
+                         config,
+                         compiled_integrand{as_function_pointer<scalar_fn>(fn),
+                                            ex},
+                         params),
+        lower, upper);
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <Rcpp.h>
+
+#include "prepared.h"
+
+// NOTE: the integrals over `(lower[i], upper[i])` of a prepared integration,
+// which are computed on first access and memoized.
+class lazy_integrals {
+   public:
+    lazy_integrals(std::unique_ptr<prepared_integration> integration,
+                   std::vector<double> lower, std::vector<double> upper)
+        : integration_{std::move(integration)},
+          lower_{std::move(lower)},
+          upper_{std::move(upper)},
+          values_(lower_.size()),
+          computed_(lower_.size(), false) {}
+
+    R_xlen_t size() const noexcept {
+        return static_cast<R_xlen_t>(values_.size());
+    }
+
+    R_xlen_t computed() const {
+        return static_cast<R_xlen_t>(
+            std::count(computed_.begin(), computed_.end(), true));
+    }
+
+    double operator[](const R_xlen_t i) {
+        if (!computed_[i]) {
+            values_[i] = integration_->run(lower_[i], upper_[i]);
+            computed_[i] = true;
+        }
+        return values_[i];
+    }
+
+   private:
+    std::unique_ptr<prepared_integration> integration_;
+    std::vector<double> lower_;
+    std::vector<double> upper_;
+    std::vector<double> values_;
+    std::vector<bool> computed_;
+};
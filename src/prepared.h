@@ -0,0 +1,77 @@
+// Copyright (C) 2023 Henrik Sloot
+//
+// This file is part of integratecpp
+//
+// integratecpp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// integratecpp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <utility>
+
+#include <Rcpp.h>
+
+#include "integratecpp.h"
+
+// NOTE: an integration with an integrand, configuration parameters, and
+// workspace bound once, such that repeated integrations over different bounds,
+// e.g., in an objective function for `optim()`, neither validate the
+// configuration parameters nor allocate the working arrays again.
+class prepared_integration {
+   public:
+    explicit prepared_integration(
+        const integratecpp::integrator::config_type &config)
+        : integrator_{config}, workspace_{config} {}
+    virtual ~prepared_integration() = default;
+
+    virtual double run(const double lower, const double upper) = 0;
+
+   protected:
+    template <typename Integrand_>
+    double integrate(const Integrand_ &fn, const double lower,
+                     const double upper) {
+        return integrator_(fn, lower, upper, workspace_).value;
+    }
+
+   private:
+    integratecpp::integrator integrator_;
+    integratecpp::integrator::workspace_type workspace_;
+};
+
+// NOTE: `data` keeps R objects referenced by the integrand alive, e.g., the
+// parameters of a compiled integrand.
+template <typename Integrand_>
+class prepared_integrand final : public prepared_integration {
+   public:
+    prepared_integrand(const integratecpp::integrator::config_type &config,
+                       Integrand_ integrand, SEXP data = R_NilValue)
+        : prepared_integration{config},
+          integrand_{std::move(integrand)},
+          data_{data} {}
+
+    double run(const double lower, const double upper) override {
+        return integrate(integrand_, lower, upper);
+    }
+
+   private:
+    Integrand_ integrand_;
+    Rcpp::RObject data_;
+};
+
+template <typename Integrand_>
+inline prepared_integration *make_prepared_integration(
+    const integratecpp::integrator::config_type &config, Integrand_ integrand,
+    SEXP data = R_NilValue) {
+    return new prepared_integrand<Integrand_>{config, std::move(integrand),
+                                              data};
+}